@@ -0,0 +1,557 @@
+// ---------------------------- benchmark.cpp --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The benchmark.cpp file is a benchmark program for the GraphM
+// and GraphL classes. It generates synthetic graphs of several families
+// and sizes, times building them, finding all of the shortest paths,
+// point-to-point display queries and the depth-first search, and prints
+// the results as JSON so that runs can be compared by a script.
+// ---------------------------------------------------------------------
+// Notes - It is built on its own instead of lab3.cpp, for example with
+//   g++ -O2 -std=c++17 -o benchmark benchmark.cpp graphm.cpp graphl.cpp
+//       nodedata.cpp csrgraph.cpp searchspace.cpp contractionhierarchy.cpp
+//       graphloader.cpp graphsnapshot.cpp graphpipeline.cpp
+//       outputbuffer.cpp tablerow.cpp densegraph.cpp floydwarshall.cpp
+//       graphstats.cpp -lpthread
+// The options are:
+//   --sizes N,N,...        numbers of nodes, 100 to 1000000 by default
+//   --families F,F,...     sparse, grid, dense and chain by default
+//   --queries N            number of display queries, 1000 by default
+//   --engine NAME          heap, dense, floyd-warshall or auto (default)
+//   --threads N            threads for findShortestPath, 0 for every core
+//   --all-pairs-limit N    largest graph findShortestPath is run on, 2000
+//   --dense-limit N        largest dense graph that is generated, 2000
+//   --seed N               seed for the random graphs, 1 by default
+// Graphs of 10^7 nodes can be run with --sizes, they take several GB of
+// memory. Each case is run in its own child process, so the peak
+// resident set size reported for a case only counts that case. Text
+// printed by display and depthFirstSearch is written to /dev/null. The
+// display queries always start from an empty table T, so latency_us is
+// the time of the lazy search at every size, including the sizes that
+// findShortestPath is run on.
+// ---------------------------------------------------------------------
+#include "graphm.h"
+#include "graphl.h"
+#include "graphloader.h"
+#include "outputbuffer.h"
+#include "densegraph.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+using namespace std;
+
+// The BenchmarkOptions struct holds the settings given on the command line
+struct BenchmarkOptions
+{
+    vector<int> sizes;
+    vector<string> families;
+    int queries;
+    ShortestPathEngine engine;
+    int threads;
+    int allPairsLimit;
+    int denseLimit;
+    unsigned seed;
+};
+
+// Average number of edges leaving a node in a sparse graph, and the chance of each edge in a
+// dense graph, in percent
+const int SPARSE_DEGREE = 4;
+const int DENSE_EDGE_PERCENT = 50;
+
+// Largest number of different source nodes the display queries start from, each one keeps a
+// row of T that the later queries from it reuse
+const int QUERY_SOURCES = 8;
+
+// --------------------------------[engineName]-----------------------------------------------
+// Description: The engineName function returns the name of an engine used in the options and
+// in the JSON output.
+// -------------------------------------------------------------------------------------------
+static const char* engineName(ShortestPathEngine engine)
+{
+    switch (engine)
+    {
+        case HEAP_ENGINE:
+            return "heap";
+        case DENSE_ENGINE:
+            return "dense";
+        case FLOYD_WARSHALL_ENGINE:
+            return "floyd-warshall";
+        default:
+            return "auto";
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[secondsSince]---------------------------------------------
+// Description: The secondsSince function returns the number of seconds since the start time.
+// -------------------------------------------------------------------------------------------
+static double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[peakResidentKilobytes]--------------------------------------
+// Description: The peakResidentKilobytes function returns the largest resident set size the
+// process has had, in kilobytes.
+// -------------------------------------------------------------------------------------------
+static long peakResidentKilobytes()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[percentile]---------------------------------------------
+// Description: The percentile function returns the value at the given percentile of the sorted
+// values, using the nearest rank.
+// -------------------------------------------------------------------------------------------
+static double percentile(const vector<double>& sortedValues, double percent)
+{
+    if (sortedValues.empty())
+    {
+        return 0;
+    }
+
+    size_t rank = static_cast<size_t>(ceil(percent / 100 * sortedValues.size()));
+    return sortedValues[min(max(rank, size_t(1)), sortedValues.size()) - 1];
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[generateGraph]--------------------------------------------
+// Description: The generateGraph function fills in a graph of the family with the number of
+// nodes, with edge weights from 1 to 100. A sparse graph has SPARSE_DEGREE random edges per
+// node, a grid graph joins each node to the nodes next to it in both directions like a road
+// map, a dense graph has each possible edge with a chance of DENSE_EDGE_PERCENT, and a chain
+// joins each node to the next one so every path is as long as it can be.
+// -------------------------------------------------------------------------------------------
+static void generateGraph(const string& family, int nodes, unsigned seed, GraphText& graph)
+{
+    mt19937 random(seed);
+    uniform_int_distribution<int> pickNode(1, nodes);
+    uniform_int_distribution<int> pickWeight(1, 100);
+
+    graph.nodeCount = nodes;
+    graph.descriptions.clear();
+    graph.edges.clear();
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        graph.descriptions.push_back("node " + to_string(node));
+    }
+
+    if (family == "sparse")
+    {
+        for (long edge = 0; edge < static_cast<long>(SPARSE_DEGREE) * nodes; edge++)
+        {
+            graph.edges.push_back({pickNode(random), pickNode(random), pickWeight(random)});
+        }
+    }
+    else if (family == "grid")
+    {
+        int side = static_cast<int>(ceil(sqrt(static_cast<double>(nodes))));
+
+        for (int node = 1; node <= nodes; node++)
+        {
+            // The node to the right, unless node is at the end of its row, and the node below
+            if (node % side != 0 && node + 1 <= nodes)
+            {
+                graph.edges.push_back({node, node + 1, pickWeight(random)});
+                graph.edges.push_back({node + 1, node, pickWeight(random)});
+            }
+
+            if (node + side <= nodes)
+            {
+                graph.edges.push_back({node, node + side, pickWeight(random)});
+                graph.edges.push_back({node + side, node, pickWeight(random)});
+            }
+        }
+    }
+    else if (family == "dense")
+    {
+        uniform_int_distribution<int> pickPercent(0, 99);
+
+        for (int fromNode = 1; fromNode <= nodes; fromNode++)
+        {
+            for (int toNode = 1; toNode <= nodes; toNode++)
+            {
+                if (fromNode != toNode && pickPercent(random) < DENSE_EDGE_PERCENT)
+                {
+                    graph.edges.push_back({fromNode, toNode, pickWeight(random)});
+                }
+            }
+        }
+    }
+    else
+    {
+        for (int node = 1; node < nodes; node++)
+        {
+            graph.edges.push_back({node, node + 1, pickWeight(random)});
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[runCase]------------------------------------------------
+// Description: The runCase function generates one graph and times each of the operations on
+// it, and returns the results as a JSON object. buildGraph is timed for GraphM and GraphL,
+// findShortestPath only for graphs up to the all-pairs limit, the display queries go from a
+// few source nodes to random destination nodes, and depthFirstSearch is timed on GraphL. The
+// queries are run on a GraphM built again after findShortestPath, so at every size they time
+// the lazy Dijkstra's algorithm of display instead of reading the rows of a full table.
+// -------------------------------------------------------------------------------------------
+static string runCase(const string& family, int nodes, const BenchmarkOptions& options)
+{
+    ostringstream json;
+    json.setf(ios::fixed);
+    json.precision(6);
+
+    GraphText graph;
+    generateGraph(family, nodes, options.seed, graph);
+    long edges = static_cast<long>(graph.edges.size());
+
+    json << "{\"family\": \"" << family << "\", \"nodes\": " << nodes << ", \"edges\": " << edges;
+
+    // Building both graphs
+    GraphM shortestPaths;
+    auto start = chrono::steady_clock::now();
+    shortestPaths.buildGraph(graph);
+    double graphMSeconds = secondsSince(start);
+
+    GraphL depthFirst;
+    start = chrono::steady_clock::now();
+    depthFirst.buildGraph(graph);
+    double graphLSeconds = secondsSince(start);
+
+    json << ", \"build\": {\"graphm_seconds\": " << graphMSeconds << ", \"graphl_seconds\": " << graphLSeconds
+         << ", \"graphm_edges_per_second\": " << edges / max(graphMSeconds, 1e-9)
+         << ", \"graphl_edges_per_second\": " << edges / max(graphLSeconds, 1e-9) << "}";
+
+    // Every shortest path, only for graphs small enough for V rows of V entries
+    shortestPaths.setEngine(options.engine);
+
+    if (nodes <= options.allPairsLimit)
+    {
+        ShortestPathEngine usedEngine = shortestPaths.selectedEngine();
+        start = chrono::steady_clock::now();
+
+        if (options.threads == 1)
+        {
+            shortestPaths.findShortestPath();
+        }
+        else
+        {
+            shortestPaths.findShortestPath(options.threads);
+        }
+
+        double seconds = secondsSince(start);
+        json << ", \"all_pairs\": {\"engine\": \"" << engineName(usedEngine) << "\", \"seconds\": " << seconds
+             << ", \"rows_per_second\": " << nodes / max(seconds, 1e-9) << "}";
+    }
+    else
+    {
+        json << ", \"all_pairs\": null";
+    }
+
+    // The table of findShortestPath is thrown away and the graph is built again without timing
+    // it, so the queries start from an empty table whether findShortestPath was run or not
+    shortestPaths = GraphM();
+    shortestPaths.setEngine(options.engine);
+    shortestPaths.buildGraph(graph);
+
+    // Point-to-point display queries, their text goes to /dev/null
+    int sink = open("/dev/null", O_WRONLY);
+    vector<double> latencies;
+
+    {
+        OutputBuffer output(sink);
+        mt19937 random(options.seed + 1);
+        uniform_int_distribution<int> pickNode(1, nodes);
+        vector<int> sources;
+
+        for (int source = 0; source < min(QUERY_SOURCES, nodes); source++)
+        {
+            sources.push_back(pickNode(random));
+        }
+
+        uniform_int_distribution<int> pickSource(0, static_cast<int>(sources.size()) - 1);
+
+        for (int query = 0; query < options.queries; query++)
+        {
+            int fromNode = sources[pickSource(random)];
+            int toNode = pickNode(random);
+
+            start = chrono::steady_clock::now();
+            shortestPaths.display(fromNode, toNode, output);
+            latencies.push_back(secondsSince(start) * 1e6);
+        }
+    }
+
+    double querySeconds = 0;
+
+    for (double latency : latencies)
+    {
+        querySeconds += latency / 1e6;
+    }
+
+    sort(latencies.begin(), latencies.end());
+    json << ", \"queries\": {\"count\": " << latencies.size() << ", \"seconds\": " << querySeconds
+         << ", \"queries_per_second\": " << latencies.size() / max(querySeconds, 1e-9)
+         << ", \"latency_us\": {\"p50\": " << percentile(latencies, 50) << ", \"p90\": " << percentile(latencies, 90)
+         << ", \"p99\": " << percentile(latencies, 99) << ", \"max\": " << (latencies.empty() ? 0 : latencies.back()) << "}}";
+
+    // Depth-first search, its text also goes to /dev/null
+    {
+        OutputBuffer output(sink);
+        start = chrono::steady_clock::now();
+        depthFirst.depthFirstSearch(output);
+        output.flush();
+        double seconds = secondsSince(start);
+
+        json << ", \"depth_first_search\": {\"seconds\": " << seconds
+             << ", \"nodes_per_second\": " << nodes / max(seconds, 1e-9) << "}";
+    }
+
+    close(sink);
+    json << ", \"peak_rss_kb\": " << peakResidentKilobytes() << "}";
+    return json.str();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[runCaseInChild]--------------------------------------------
+// Description: The runCaseInChild function runs one case in a child process and returns the
+// JSON object it wrote to a pipe. If the child fails, for example because it ran out of
+// memory, an object with an error is returned instead.
+// -------------------------------------------------------------------------------------------
+static string runCaseInChild(const string& family, int nodes, const BenchmarkOptions& options)
+{
+    int channel[2];
+
+    if (pipe(channel) != 0)
+    {
+        return runCase(family, nodes, options);
+    }
+
+    cout.flush();
+    pid_t child = fork();
+
+    // If there is no child process the case is run in this one
+    if (child < 0)
+    {
+        close(channel[0]);
+        close(channel[1]);
+        return runCase(family, nodes, options);
+    }
+
+    if (child == 0)
+    {
+        close(channel[0]);
+        string result = runCase(family, nodes, options);
+        size_t written = 0;
+
+        while (written < result.size())
+        {
+            ssize_t count = write(channel[1], result.data() + written, result.size() - written);
+
+            if (count <= 0)
+            {
+                break;
+            }
+            written += count;
+        }
+        _exit(0);
+    }
+
+    close(channel[1]);
+    string result;
+    char block[4096];
+    ssize_t count;
+
+    while ((count = read(channel[0], block, sizeof(block))) > 0)
+    {
+        result.append(block, count);
+    }
+
+    close(channel[0]);
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || result.empty())
+    {
+        result = "{\"family\": \"" + family + "\", \"nodes\": " + to_string(nodes) + ", \"error\": \"case did not finish\"}";
+    }
+    return result;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[splitList]---------------------------------------------
+// Description: The splitList function splits a comma separated list into its items.
+// -------------------------------------------------------------------------------------------
+static vector<string> splitList(const string& list)
+{
+    vector<string> items;
+    stringstream stream(list);
+    string item;
+
+    while (getline(stream, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[parseOptions]--------------------------------------------
+// Description: The parseOptions function reads the command line options into the options,
+// it returns false and prints the usage if an option is not known or has no value.
+// -------------------------------------------------------------------------------------------
+static bool parseOptions(int argc, char* argv[], BenchmarkOptions& options)
+{
+    options.sizes = {100, 1000, 10000, 100000, 1000000};
+    options.families = {"sparse", "grid", "dense", "chain"};
+    options.queries = 1000;
+    options.engine = AUTO_ENGINE;
+    options.threads = 1;
+    options.allPairsLimit = 2000;
+    options.denseLimit = 2000;
+    options.seed = 1;
+
+    for (int argument = 1; argument < argc; argument++)
+    {
+        string option = argv[argument];
+
+        if (argument + 1 >= argc)
+        {
+            cerr << "missing value for " << option << endl;
+            return false;
+        }
+
+        string value = argv[++argument];
+
+        if (option == "--sizes")
+        {
+            options.sizes.clear();
+
+            for (const string& size : splitList(value))
+            {
+                options.sizes.push_back(max(1, atoi(size.c_str())));
+            }
+        }
+        else if (option == "--families")
+        {
+            options.families = splitList(value);
+
+            for (const string& family : options.families)
+            {
+                if (family != "sparse" && family != "grid" && family != "dense" && family != "chain")
+                {
+                    cerr << "unknown family " << family << endl;
+                    return false;
+                }
+            }
+        }
+        else if (option == "--queries")
+        {
+            options.queries = max(0, atoi(value.c_str()));
+        }
+        else if (option == "--engine")
+        {
+            ShortestPathEngine engines[] = {HEAP_ENGINE, DENSE_ENGINE, FLOYD_WARSHALL_ENGINE, AUTO_ENGINE};
+            bool found = false;
+
+            for (ShortestPathEngine engine : engines)
+            {
+                if (value == engineName(engine))
+                {
+                    options.engine = engine;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                cerr << "unknown engine " << value << endl;
+                return false;
+            }
+        }
+        else if (option == "--threads")
+        {
+            options.threads = max(0, atoi(value.c_str()));
+        }
+        else if (option == "--all-pairs-limit")
+        {
+            options.allPairsLimit = atoi(value.c_str());
+        }
+        else if (option == "--dense-limit")
+        {
+            options.denseLimit = atoi(value.c_str());
+        }
+        else if (option == "--seed")
+        {
+            options.seed = static_cast<unsigned>(strtoul(value.c_str(), nullptr, 10));
+        }
+        else
+        {
+            cerr << "unknown option " << option << endl;
+            return false;
+        }
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+
+    if (!parseOptions(argc, argv, options))
+    {
+        cerr << "usage: benchmark [--sizes N,N,...] [--families sparse,grid,dense,chain] [--queries N]" << endl
+             << "                 [--engine heap|dense|floyd-warshall|auto] [--threads N]" << endl
+             << "                 [--all-pairs-limit N] [--dense-limit N] [--seed N]" << endl;
+        return 1;
+    }
+
+    cout << "{\"engine\": \"" << engineName(options.engine) << "\", \"threads\": " << options.threads
+         << ", \"dense_kernel\": \"" << DenseGraph::kernelName() << "\", \"seed\": " << options.seed
+         << ", \"results\": [";
+
+    bool first = true;
+
+    for (const string& family : options.families)
+    {
+        for (int nodes : options.sizes)
+        {
+            // Dense graphs have V^2 / 2 edges, so only small ones are generated
+            if (family == "dense" && nodes > options.denseLimit)
+            {
+                continue;
+            }
+
+            cout << (first ? "\n  " : ",\n  ") << runCaseInChild(family, nodes, options);
+            cout.flush();
+            first = false;
+        }
+    }
+
+    cout << "\n]}" << endl;
+    return 0;
+}
@@ -0,0 +1,503 @@
+// ---------------------- contractionhierarchy.cpp ---------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The contractionhierarchy.cpp file is the implementation file
+// for the ContractionHierarchy class. It contains the preprocessing that
+// orders the nodes and adds the shortcut edges, the upward bidirectional
+// search that answers a query and the unpacking of shortcuts into the
+// nodes of the original graph.
+// ---------------------------------------------------------------------
+// Notes - The contraction order is picked with a heap keyed by the edge
+// difference of each node (the shortcuts its contraction would add minus
+// the edges it would remove) plus the number of its neighbors that have
+// already been contracted, which keeps the contraction spread out over
+// the graph. The key of a node is only recomputed when it reaches the top
+// of the heap (lazy updates). Witness searches are cut off after a fixed
+// number of nodes, which can only add extra shortcuts and never loses a
+// shortest path. When there is more than one shortest path the query can
+// return a different one of them than Dijkstra's algorithm would.
+// ---------------------------------------------------------------------
+#include "contractionhierarchy.h"
+#include "indexedheap.h"
+#include "weighttraits.h"
+#include <vector>
+#include <climits>
+#include <algorithm>
+using namespace std;
+
+// Number of nodes a witness search visits before it gives up
+const int WITNESS_VISIT_LIMIT = 500;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The ContractionHierarchy constructor creates an empty hierarchy that has not
+// been built yet.
+// -------------------------------------------------------------------------------------------
+ContractionHierarchy::ContractionHierarchy()
+{
+    clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method throws away the hierarchy, it has to be built again before it
+// can answer queries.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::clear()
+{
+    nodes = 0;
+    built = false;
+    shortcuts = 0;
+    rank.clear();
+    forwardUpward.offsets.clear();
+    forwardUpward.edges.clear();
+    backwardUpward.offsets.clear();
+    backwardUpward.edges.clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[isBuilt]-----------------------------------------------
+// Description: The isBuilt method returns true once the hierarchy has been built.
+// -------------------------------------------------------------------------------------------
+bool ContractionHierarchy::isBuilt() const
+{
+    return built;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[shortcutCount]--------------------------------------------
+// Description: The shortcutCount method returns the number of shortcut edges added by build.
+// -------------------------------------------------------------------------------------------
+int ContractionHierarchy::shortcutCount() const
+{
+    return shortcuts;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[build]------------------------------------------------
+// Description: The build method preprocesses the graph into a contraction hierarchy. The
+// edges of the graph are copied into edge lists that shortcuts can be added to, then the nodes
+// are contracted one at a time in the order picked by the heap, and finally the edges that
+// lead to a node of higher rank are stored for the forward and backward query searches.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::build(const CsrGraph& graph)
+{
+    clear();
+    nodes = graph.nodeCount();
+
+    // Edges leaving and coming into each node, shortcuts are added to these lists
+    vector<vector<HierarchyEdge>> outEdges(nodes + 1);
+    vector<vector<HierarchyEdge>> inEdges(nodes + 1);
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        for (int edge = graph.beginEdge(node); edge < graph.endEdge(node); edge++)
+        {
+            // Edges from a node to itself are never on a shortest path
+            if (graph.edgeTarget(edge) == node)
+            {
+                continue;
+            }
+
+            setEdge(outEdges[node], graph.edgeTarget(edge), graph.edgeWeight(edge), 0);
+            setEdge(inEdges[graph.edgeTarget(edge)], node, graph.edgeWeight(edge), 0);
+        }
+    }
+
+    // Every node is given its first key, which is how many edges its contraction would add
+    // minus how many edges it would remove
+    vector<char> contracted(nodes + 1, 0);
+    vector<int> contractedNeighbors(nodes + 1, 0);
+    SearchSpace witnessSearch;
+    witnessSearch.resize(nodes);
+    IndexedHeap<4> order(nodes + 1);
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        int addedEdges = contractNode(node, outEdges, inEdges, contracted, witnessSearch, false);
+        int removedEdges = static_cast<int>(outEdges[node].size() + inEdges[node].size());
+        order.push(node, addedEdges - removedEdges);
+    }
+
+    rank.assign(nodes + 1, 0);
+    int nextRank = 1;
+
+    while (!order.empty())
+    {
+        // The key of the node at the top of the heap is recomputed, since contracting other nodes
+        // may have changed it, and the node goes back into the heap if it is no longer the smallest
+        int node = order.popMin();
+        int addedEdges = contractNode(node, outEdges, inEdges, contracted, witnessSearch, false);
+        int removedEdges = 0;
+
+        for (const HierarchyEdge& edge : outEdges[node])
+        {
+            removedEdges += (contracted[edge.otherNode] == 0) ? 1 : 0;
+        }
+        for (const HierarchyEdge& edge : inEdges[node])
+        {
+            removedEdges += (contracted[edge.otherNode] == 0) ? 1 : 0;
+        }
+
+        int key = addedEdges - removedEdges + contractedNeighbors[node];
+
+        if (!order.empty() && key > order.minDistance())
+        {
+            order.push(node, key);
+            continue;
+        }
+
+        // The node is contracted, adding the shortcuts its neighbors need, and its neighbors
+        // remember that one more of their neighbors has been contracted
+        shortcuts += contractNode(node, outEdges, inEdges, contracted, witnessSearch, true);
+        contracted[node] = 1;
+        rank[node] = nextRank++;
+
+        for (const HierarchyEdge& edge : outEdges[node])
+        {
+            contractedNeighbors[edge.otherNode]++;
+        }
+        for (const HierarchyEdge& edge : inEdges[node])
+        {
+            contractedNeighbors[edge.otherNode]++;
+        }
+    }
+
+    // Only the edges that lead up to a node of higher rank are needed by the query searches
+    buildUpward(forwardUpward, outEdges);
+    buildUpward(backwardUpward, inEdges);
+
+    forwardSearch.resize(nodes);
+    backwardSearch.resize(nodes);
+    built = true;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[contractNode]---------------------------------------------
+// Description: The contractNode method counts the shortcuts needed to contract the node, and
+// adds them to the edge lists if addShortcuts is true. For every edge coming into the node
+// from a node u that has not been contracted, a witness search is run from u that is not
+// allowed to pass through the node. Every edge leaving the node to a node x that has not been
+// contracted needs a shortcut from u to x unless the witness search found a path from u to x
+// that is no longer than the path through the node. The number of shortcuts is returned.
+// -------------------------------------------------------------------------------------------
+int ContractionHierarchy::contractNode(int node, vector<vector<HierarchyEdge>>& outEdges,
+                                       vector<vector<HierarchyEdge>>& inEdges, const vector<char>& contracted,
+                                       SearchSpace& witnessSearch, bool addShortcuts)
+{
+    int shortcutsNeeded = 0;
+
+    // The longest edge leaving the node bounds how far the witness searches have to go
+    int longestOutEdge = -1;
+
+    for (const HierarchyEdge& outEdge : outEdges[node])
+    {
+        if (contracted[outEdge.otherNode] == 0)
+        {
+            longestOutEdge = max(longestOutEdge, outEdge.weight);
+        }
+    }
+
+    if (longestOutEdge < 0)
+    {
+        return 0;
+    }
+
+    // The in edges are copied because adding shortcuts can change the edge lists
+    vector<HierarchyEdge> incoming = inEdges[node];
+
+    for (const HierarchyEdge& inEdge : incoming)
+    {
+        int fromNode = inEdge.otherNode;
+
+        if (contracted[fromNode] != 0)
+        {
+            continue;
+        }
+
+        // Search for other paths from fromNode that are no longer than the paths through the node
+        searchWitnesses(fromNode, node, inEdge.weight + longestOutEdge, outEdges, contracted, witnessSearch);
+
+        for (const HierarchyEdge& outEdge : outEdges[node])
+        {
+            int toNode = outEdge.otherNode;
+
+            if (contracted[toNode] != 0 || toNode == fromNode)
+            {
+                continue;
+            }
+
+            // A shortcut is needed if the path through the node is shorter than every witness path
+            int throughNode = inEdge.weight + outEdge.weight;
+
+            if (witnessSearch.distance(toNode) <= throughNode)
+            {
+                continue;
+            }
+
+            shortcutsNeeded++;
+
+            if (addShortcuts)
+            {
+                setEdge(outEdges[fromNode], toNode, throughNode, node);
+                setEdge(inEdges[toNode], fromNode, throughNode, node);
+            }
+        }
+    }
+
+    return shortcutsNeeded;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[searchWitnesses]-------------------------------------------
+// Description: The searchWitnesses method runs a Dijkstra's search from the source node over
+// the nodes that have not been contracted, without passing through the skipped node. The
+// search stops once its next node is past the maximum distance, or after it has visited
+// WITNESS_VISIT_LIMIT nodes. The distances it found are left in the witness search, each one
+// is the length of a real path even if the node was never visited.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::searchWitnesses(int fromNode, int skippedNode, int maximumDistance,
+                                           const vector<vector<HierarchyEdge>>& outEdges,
+                                           const vector<char>& contracted, SearchSpace& witnessSearch)
+{
+    witnessSearch.clear();
+    witnessSearch.relax(fromNode, 0, 0);
+
+    while (!witnessSearch.empty() && witnessSearch.minDistance() <= maximumDistance &&
+           witnessSearch.visitedCount() < WITNESS_VISIT_LIMIT)
+    {
+        int currentNode = witnessSearch.visitNext();
+
+        for (const HierarchyEdge& edge : outEdges[currentNode])
+        {
+            if (edge.otherNode == skippedNode || contracted[edge.otherNode] != 0)
+            {
+                continue;
+            }
+
+            witnessSearch.relax(edge.otherNode, WeightTraits<int>::extend(witnessSearch.distance(currentNode), edge.weight), currentNode);
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[setEdge]----------------------------------------------
+// Description: The setEdge method adds an edge to otherNode to the edge list, or if the list
+// already has an edge to otherNode, keeps whichever of the two edges is shorter.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::setEdge(vector<HierarchyEdge>& edges, int otherNode, int weight, int middleNode)
+{
+    for (HierarchyEdge& edge : edges)
+    {
+        if (edge.otherNode == otherNode)
+        {
+            if (weight < edge.weight)
+            {
+                edge.weight = weight;
+                edge.middleNode = middleNode;
+            }
+            return;
+        }
+    }
+
+    edges.push_back({otherNode, weight, middleNode});
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[buildUpward]--------------------------------------------
+// Description: The buildUpward method stores the edges from the edge lists whose other node
+// has a higher rank than the node they are stored at, in compressed sparse row form.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::buildUpward(UpwardEdges& upward, const vector<vector<HierarchyEdge>>& edges)
+{
+    upward.offsets.assign(nodes + 2, 0);
+    upward.edges.clear();
+
+    for (int node = 0; node <= nodes; node++)
+    {
+        upward.offsets[node] = static_cast<int>(upward.edges.size());
+
+        if (node == 0)
+        {
+            continue;
+        }
+
+        for (const HierarchyEdge& edge : edges[node])
+        {
+            if (rank[edge.otherNode] > rank[node])
+            {
+                upward.edges.push_back(edge);
+            }
+        }
+    }
+
+    upward.offsets[nodes + 1] = static_cast<int>(upward.edges.size());
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[shortestPath]--------------------------------------------
+// Description: The shortestPath method answers a query with two searches that only go up the
+// hierarchy, a forward search from the source node and a backward search from the destination
+// node. Every shortest path has a node of highest rank on it, which both searches can reach
+// by only going up, so the shortest path is the shortest sum of the two search distances over
+// the nodes both searches visit. A search stops once its smallest waiting distance is at least
+// the shortest path found. The path is then unpacked into the nodes of the original graph.
+// -------------------------------------------------------------------------------------------
+int ContractionHierarchy::shortestPath(int fromNode, int toNode, vector<int>& path)
+{
+    path.clear();
+
+    if (!built || fromNode > nodes || fromNode < 1 || toNode > nodes || toNode < 1)
+    {
+        return INT_MAX;
+    }
+
+    forwardSearch.clear();
+    backwardSearch.clear();
+    forwardSearch.relax(fromNode, 0, 0);
+    backwardSearch.relax(toNode, 0, 0);
+
+    int shortestDistance = INT_MAX;
+    int meetingNode = 0;
+
+    // Step whichever search has the smaller distance waiting, until neither can find a shorter path
+    while (true)
+    {
+        bool forwardDone = forwardSearch.minDistance() >= shortestDistance;
+        bool backwardDone = backwardSearch.minDistance() >= shortestDistance;
+
+        if (forwardDone && backwardDone)
+        {
+            break;
+        }
+
+        if (!forwardDone && (backwardDone || forwardSearch.minDistance() <= backwardSearch.minDistance()))
+        {
+            searchUpward(forwardSearch, forwardUpward, backwardSearch, shortestDistance, meetingNode);
+        }
+        else
+        {
+            searchUpward(backwardSearch, backwardUpward, forwardSearch, shortestDistance, meetingNode);
+        }
+    }
+
+    if (shortestDistance == INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    // The hierarchy nodes from the source node up to the meeting node and back down to the
+    // destination node, each edge between them is then unpacked into original edges
+    vector<int> hierarchyPath;
+
+    for (int node = meetingNode; node != 0; node = forwardSearch.previous(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+    reverse(hierarchyPath.begin(), hierarchyPath.end());
+
+    for (int node = backwardSearch.previous(meetingNode); node != 0; node = backwardSearch.previous(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+
+    path.push_back(fromNode);
+
+    for (size_t index = 1; index < hierarchyPath.size(); index++)
+    {
+        unpackEdge(hierarchyPath[index - 1], hierarchyPath[index], path);
+    }
+
+    return shortestDistance;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[searchUpward]--------------------------------------------
+// Description: The searchUpward method visits the next node of one of the query searches. If
+// the other search has reached the node, the path through it is compared with the shortest
+// path found so far, then the upward edges of the node are relaxed.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::searchUpward(SearchSpace& search, const UpwardEdges& upward, SearchSpace& otherSearch,
+                                        int& shortestDistance, int& meetingNode)
+{
+    int currentNode = search.visitNext();
+
+    if (otherSearch.distance(currentNode) != INT_MAX &&
+        static_cast<long long>(search.distance(currentNode)) + otherSearch.distance(currentNode) < shortestDistance)
+    {
+        shortestDistance = search.distance(currentNode) + otherSearch.distance(currentNode);
+        meetingNode = currentNode;
+    }
+
+    for (int edge = upward.offsets[currentNode]; edge < upward.offsets[currentNode + 1]; edge++)
+    {
+        const HierarchyEdge& upwardEdge = upward.edges[edge];
+        search.relax(upwardEdge.otherNode, WeightTraits<int>::extend(search.distance(currentNode), upwardEdge.weight), currentNode);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[findMiddleNode]-------------------------------------------
+// Description: The findMiddleNode method returns the node that the hierarchy edge from fromNode
+// to toNode skips over, or 0 if it is an edge of the original graph. The edge is stored at
+// whichever of its two nodes has the lower rank.
+// -------------------------------------------------------------------------------------------
+int ContractionHierarchy::findMiddleNode(int fromNode, int toNode) const
+{
+    if (rank[fromNode] < rank[toNode])
+    {
+        for (int edge = forwardUpward.offsets[fromNode]; edge < forwardUpward.offsets[fromNode + 1]; edge++)
+        {
+            if (forwardUpward.edges[edge].otherNode == toNode)
+            {
+                return forwardUpward.edges[edge].middleNode;
+            }
+        }
+    }
+    else
+    {
+        for (int edge = backwardUpward.offsets[toNode]; edge < backwardUpward.offsets[toNode + 1]; edge++)
+        {
+            if (backwardUpward.edges[edge].otherNode == fromNode)
+            {
+                return backwardUpward.edges[edge].middleNode;
+            }
+        }
+    }
+    return 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[unpackEdge]----------------------------------------------
+// Description: The unpackEdge method adds the nodes after fromNode on the original path of the
+// hierarchy edge from fromNode to toNode to the end of path. A shortcut is split into the two
+// edges on either side of the node it skips, which may be shortcuts themselves, so the edges
+// waiting to be unpacked are kept on a stack with the next one on top.
+// -------------------------------------------------------------------------------------------
+void ContractionHierarchy::unpackEdge(int fromNode, int toNode, vector<int>& path) const
+{
+    vector<pair<int, int>> waitingEdges;
+    waitingEdges.push_back(make_pair(fromNode, toNode));
+
+    while (!waitingEdges.empty())
+    {
+        pair<int, int> edge = waitingEdges.back();
+        waitingEdges.pop_back();
+
+        int middleNode = findMiddleNode(edge.first, edge.second);
+
+        // An original edge adds its destination node to the path
+        if (middleNode == 0)
+        {
+            path.push_back(edge.second);
+            continue;
+        }
+
+        // A shortcut is replaced by its two halves, the first half goes on top of the stack
+        waitingEdges.push_back(make_pair(middleNode, edge.second));
+        waitingEdges.push_back(make_pair(edge.first, middleNode));
+    }
+}
+// -------------------------------------------------------------------------------------------
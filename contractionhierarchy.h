@@ -0,0 +1,108 @@
+// ----------------------- contractionhierarchy.h ----------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The contractionhierarchy.h file is the header file for the
+// ContractionHierarchy class, which answers shortest path queries on a
+// graph after preprocessing it into a contraction hierarchy. GraphM builds
+// one from its edges so that repeated point-to-point queries only search a
+// few hundred nodes instead of running Dijkstra's algorithm over the graph.
+// ---------------------------------------------------------------------
+// Notes - The preprocessing contracts the nodes one at a time, least
+// important first. Contracting a node removes it from the graph, and for
+// every pair of its neighbors whose shortest path went through it a
+// shortcut edge is added with the combined weight, unless a witness search
+// finds another path that is just as short. The order the nodes were
+// contracted in is their rank. A query then runs a forward search from the
+// source node and a backward search from the destination node that only
+// follow edges to nodes of higher rank, and the shortest path is found
+// where they meet. Every shortcut remembers the node it skipped over, so
+// the path can be unpacked back into the edges of the original graph.
+// ---------------------------------------------------------------------
+#ifndef CONTRACTION_HIERARCHY_H
+#define CONTRACTION_HIERARCHY_H
+#include "csrgraph.h"
+#include "searchspace.h"
+#include <vector>
+using namespace std;
+
+class ContractionHierarchy {
+
+    public:
+        // ContractionHierarchy constructor creates an empty hierarchy that has not been built
+        ContractionHierarchy();
+
+        // build orders the nodes of the graph and adds the shortcut edges
+        void build(const CsrGraph& graph);
+
+        // clear throws the hierarchy away, isBuilt returns true once build has been called
+        void clear();
+        bool isBuilt() const;
+
+        // shortestPath returns the shortest distance from fromNode to toNode, or infinity if there is
+        // no path, and fills path with the nodes of the original graph on the path
+        int shortestPath(int fromNode, int toNode, vector<int>& path);
+
+        // shortcutCount returns the number of shortcut edges added by build
+        int shortcutCount() const;
+
+    private:
+        // The HierarchyEdge struct is an edge of the hierarchy, middleNode is the contracted node
+        // that a shortcut skips over, or 0 for an edge of the original graph
+        struct HierarchyEdge
+        {
+            int otherNode;
+            int weight;
+            int middleNode;
+        };
+
+        // The UpwardEdges struct stores the edges from each node to nodes of higher rank in
+        // compressed sparse row form, the edges of node n are from offsets[n] to offsets[n + 1]
+        struct UpwardEdges
+        {
+            vector<int> offsets;
+            vector<HierarchyEdge> edges;
+        };
+
+        // Number of nodes in the graph
+        int nodes;
+
+        // Set to true once build has been called
+        bool built;
+
+        // Number of shortcut edges added by build
+        int shortcuts;
+
+        // Position of each node in the contraction order, higher ranks were contracted later
+        vector<int> rank;
+
+        // Edges leaving each node to a node of higher rank, searched by the forward search
+        UpwardEdges forwardUpward;
+
+        // Edges coming into each node from a node of higher rank, stored at the lower ranked node
+        // with otherNode set to where the edge comes from, searched by the backward search
+        UpwardEdges backwardUpward;
+
+        // Search spaces for the forward and backward searches of a query
+        SearchSpace forwardSearch;
+        SearchSpace backwardSearch;
+
+        // Helper methods used while building the hierarchy
+        int contractNode(int node, vector<vector<HierarchyEdge>>& outEdges, vector<vector<HierarchyEdge>>& inEdges,
+                         const vector<char>& contracted, SearchSpace& witnessSearch, bool addShortcuts);
+        void searchWitnesses(int fromNode, int skippedNode, int maximumDistance,
+                             const vector<vector<HierarchyEdge>>& outEdges, const vector<char>& contracted,
+                             SearchSpace& witnessSearch);
+        void setEdge(vector<HierarchyEdge>& edges, int otherNode, int weight, int middleNode);
+        void buildUpward(UpwardEdges& upward, const vector<vector<HierarchyEdge>>& edges);
+
+        // Helper methods used to answer a query
+        void searchUpward(SearchSpace& search, const UpwardEdges& upward, SearchSpace& otherSearch,
+                          int& shortestDistance, int& meetingNode);
+        int findMiddleNode(int fromNode, int toNode) const;
+        void unpackEdge(int fromNode, int toNode, vector<int>& path) const;
+};
+
+#endif
@@ -0,0 +1,495 @@
+// ---------------------------- csrgraph.cpp ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The csrgraph.cpp file is the implementation file for the
+// CsrGraph class. It contains the implementation of the methods that
+// build the compressed sparse row arrays from a list of edges and the
+// methods that find, change, insert and remove a single edge.
+// ---------------------------------------------------------------------
+// Notes - The build method places the edges with a counting sort on the
+// source node, which takes O(V + E) time and keeps the edges of each node
+// in the order they appear in the edge list. The first edge inserted or
+// removed after a build gives every row its own end and limit, which
+// takes O(V) time. After that, removing an edge only shifts the edges
+// after it in its row, and inserting an edge uses the next unused slot of
+// its row, or moves the row to the end of the arrays with room for twice
+// as many edges when the row is full, so both take time in the degree of
+// the source node (amortized for the insert). The rows are compacted in
+// O(V + E) time once the unused slots outnumber the edges and nodes, which
+// can only happen after that many changes. Changing the weight of an
+// existing edge only searches the edges of the source node.
+// ---------------------------------------------------------------------
+#include "csrgraph.h"
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+// Starting value and multiplier of the 64-bit FNV-1a hash used by checksum
+const unsigned long long FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const unsigned long long FNV_PRIME = 1099511628211ULL;
+
+// Number of slots given to a row that is moved to the end of the arrays, when twice its
+// number of edges would be fewer
+const int MIN_ROW_SLOTS = 4;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The CsrGraph constructor creates a graph with no nodes and no edges.
+// -------------------------------------------------------------------------------------------
+CsrGraph::CsrGraph()
+{
+    nodes = 0;
+    edges = 0;
+
+    // Row 0 is always present so that offsets[1] can be read
+    offsets.assign(2, 0);
+    useOwnArrays();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[Copy Constructor]------------------------------------------
+// Description: The CsrGraph copy constructor copies the graph, using the assignment operator.
+// -------------------------------------------------------------------------------------------
+CsrGraph::CsrGraph(const CsrGraph& other)
+{
+    *this = other;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[operator=]-------------------------------------------------
+// Description: The assignment operator copies the graph. The arrays of the copy point at its
+// own vectors, or at the same viewed arrays if the other graph is a view.
+// -------------------------------------------------------------------------------------------
+CsrGraph& CsrGraph::operator=(const CsrGraph& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    nodes = other.nodes;
+    edges = other.edges;
+    offsets = other.offsets;
+    rowEnds = other.rowEnds;
+    rowLimits = other.rowLimits;
+    targets = other.targets;
+    weights = other.weights;
+    viewOwner = other.viewOwner;
+
+    if (viewOwner)
+    {
+        offsetArray = other.offsetArray;
+        endArray = other.endArray;
+        targetArray = other.targetArray;
+        weightArray = other.weightArray;
+    }
+    else
+    {
+        useOwnArrays();
+    }
+    return *this;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[build]------------------------------------------------
+// Description: The build method replaces the contents of the graph with the given
+// number of nodes and list of edges. The edges are placed with a counting sort on
+// their source node so the edges of each node keep their order from the edge list.
+// If keepParallelEdges is false, an edge that appears more than once in the list is
+// stored once, at the position of its first appearance and with its last weight.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::build(int nodeCount, const vector<CsrEdge>& edgeList, bool keepParallelEdges)
+{
+    nodes = nodeCount;
+    edges = static_cast<int>(edgeList.size());
+    viewOwner.reset();
+    rowEnds.clear();
+    rowLimits.clear();
+
+    // Count the number of edges leaving each node, shifted by one so that the
+    // running sum below gives the first subscript of each node
+    offsets.assign(nodes + 2, 0);
+
+    for (const CsrEdge& edge : edgeList)
+    {
+        offsets[edge.fromNode + 1]++;
+    }
+
+    for (int node = 1; node <= nodes + 1; node++)
+    {
+        offsets[node] += offsets[node - 1];
+    }
+
+    // Place every edge in the next free slot of its source node
+    targets.resize(edgeList.size());
+    weights.resize(edgeList.size());
+    vector<int> nextSlot(offsets.begin(), offsets.end() - 1);
+
+    for (const CsrEdge& edge : edgeList)
+    {
+        int slot = nextSlot[edge.fromNode]++;
+        targets[slot] = edge.toNode;
+        weights[slot] = edge.weight;
+    }
+
+    if (keepParallelEdges)
+    {
+        useOwnArrays();
+        return;
+    }
+
+    // Remove the repeated edges of each node in place, slotOfTarget remembers where the
+    // edge to each destination node was kept for the node currently being compacted
+    vector<int> slotOfTarget(nodes + 1, -1);
+    int keptEdges = 0;
+
+    for (int node = 0; node <= nodes; node++)
+    {
+        int rowBegin = offsets[node];
+        int rowEnd = offsets[node + 1];
+        offsets[node] = keptEdges;
+
+        for (int edge = rowBegin; edge < rowEnd; edge++)
+        {
+            // A repeated edge only overwrites the weight of the edge that was kept
+            if (slotOfTarget[targets[edge]] != -1)
+            {
+                weights[slotOfTarget[targets[edge]]] = weights[edge];
+                continue;
+            }
+
+            slotOfTarget[targets[edge]] = keptEdges;
+            targets[keptEdges] = targets[edge];
+            weights[keptEdges] = weights[edge];
+            keptEdges++;
+        }
+
+        // Clear the markers of this node before moving on to the next node
+        for (int edge = offsets[node]; edge < keptEdges; edge++)
+        {
+            slotOfTarget[targets[edge]] = -1;
+        }
+    }
+
+    offsets[nodes + 1] = keptEdges;
+    targets.resize(keptEdges);
+    weights.resize(keptEdges);
+    edges = keptEdges;
+    useOwnArrays();
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[buildReverse]--------------------------------------------
+// Description: The buildReverse method replaces the contents of the graph with the edges of
+// the given graph pointing the other way, so the edges of a node in the reversed graph are
+// the edges coming into that node in the given graph.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::buildReverse(const CsrGraph& graph)
+{
+    vector<CsrEdge> reversedEdges;
+    reversedEdges.reserve(graph.edgeCount());
+
+    for (int node = 1; node <= graph.nodeCount(); node++)
+    {
+        for (int edge = graph.beginEdge(node); edge < graph.endEdge(node); edge++)
+        {
+            reversedEdges.push_back({graph.edgeTarget(edge), node, graph.edgeWeight(edge)});
+        }
+    }
+
+    build(graph.nodeCount(), reversedEdges, true);
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[view]------------------------------------------------
+// Description: The view method replaces the contents of the graph with a view of arrays that
+// are laid out like the graph's own arrays, nothing is copied. The graph keeps a reference
+// to owner so that the memory holding the arrays is not released while it is being used.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::view(int nodeCount, int edgeCount, const int* offsetView, const int* targetView,
+                    const int* weightView, shared_ptr<const void> owner)
+{
+    nodes = nodeCount;
+    edges = edgeCount;
+
+    // The graph's own vectors are released, the view is used instead
+    vector<int>().swap(offsets);
+    vector<int>().swap(rowEnds);
+    vector<int>().swap(rowLimits);
+    vector<int>().swap(targets);
+    vector<int>().swap(weights);
+
+    offsetArray = offsetView;
+    endArray = offsetView + 1;
+    targetArray = targetView;
+    weightArray = weightView;
+    viewOwner = owner;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[isCompact]----------------------------------------------
+// Description: The isCompact method returns true if the rows of the graph are stored back to
+// back, so that the edges of each node end where the edges of the next node begin.
+// -------------------------------------------------------------------------------------------
+bool CsrGraph::isCompact() const
+{
+    return rowEnds.empty();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[compact]----------------------------------------------
+// Description: The compact method copies the rows of the graph back to back into new arrays,
+// dropping the unused slots left by inserted and removed edges, so that the arrays are laid
+// out as CSR arrays again. The edges of each node keep their order.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::compact()
+{
+    if (isCompact())
+    {
+        return;
+    }
+
+    vector<int> compactOffsets(nodes + 2, 0);
+    vector<int> compactTargets;
+    vector<int> compactWeights;
+    compactTargets.reserve(edges);
+    compactWeights.reserve(edges);
+
+    for (int node = 0; node <= nodes; node++)
+    {
+        compactOffsets[node] = static_cast<int>(compactTargets.size());
+        compactTargets.insert(compactTargets.end(), targets.begin() + offsets[node], targets.begin() + rowEnds[node]);
+        compactWeights.insert(compactWeights.end(), weights.begin() + offsets[node], weights.begin() + rowEnds[node]);
+    }
+
+    compactOffsets[nodes + 1] = edges;
+    offsets.swap(compactOffsets);
+    targets.swap(compactTargets);
+    weights.swap(compactWeights);
+    vector<int>().swap(rowEnds);
+    vector<int>().swap(rowLimits);
+    useOwnArrays();
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[offsetData]---------------------------------------------
+// Description: The offsetData method returns the array of the first edge of each node, it
+// has nodeCount() + 2 entries. Like targetData and weightData, it only describes the edges of
+// each node by itself while the graph is compact.
+// -------------------------------------------------------------------------------------------
+const int* CsrGraph::offsetData() const
+{
+    return offsetArray;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[targetData]---------------------------------------------
+// Description: The targetData method returns the array of the destination node of every edge.
+// -------------------------------------------------------------------------------------------
+const int* CsrGraph::targetData() const
+{
+    return targetArray;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[weightData]---------------------------------------------
+// Description: The weightData method returns the array of the weight of every edge.
+// -------------------------------------------------------------------------------------------
+const int* CsrGraph::weightData() const
+{
+    return weightArray;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[findEdge]----------------------------------------------
+// Description: The findEdge method returns the subscript of the edge from the source node
+// to the destination node, or -1 if there is no such edge.
+// -------------------------------------------------------------------------------------------
+int CsrGraph::findEdge(int fromNode, int toNode) const
+{
+    for (int edge = offsetArray[fromNode]; edge < endArray[fromNode]; edge++)
+    {
+        if (targetArray[edge] == toNode)
+        {
+            return edge;
+        }
+    }
+    return -1;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[checksum]----------------------------------------------
+// Description: The checksum method returns a 64-bit FNV-1a hash of the graph. For every node
+// the number of its edges is hashed, followed by the destination node and weight of each of
+// its edges in order, so two graphs only get the same checksum if every node has the same
+// edges in the same order, apart from a very unlikely collision.
+// -------------------------------------------------------------------------------------------
+unsigned long long CsrGraph::checksum() const
+{
+    unsigned long long hash = FNV_OFFSET_BASIS;
+
+    // Each value is mixed into the hash as one 32-bit word
+    auto mix = [&hash](int value)
+    {
+        hash = (hash ^ static_cast<unsigned int>(value)) * FNV_PRIME;
+    };
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        mix(endEdge(node) - beginEdge(node));
+
+        for (int edge = beginEdge(node); edge < endEdge(node); edge++)
+        {
+            mix(edgeTarget(edge));
+            mix(edgeWeight(edge));
+        }
+    }
+    return hash;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[setEdge]----------------------------------------------
+// Description: The setEdge method sets the weight of the edge from the source node to the
+// destination node. If the edge does not exist yet it is inserted after the other edges
+// of the source node, in the next unused slot of its row. A row with no unused slot left is
+// first moved to the end of the arrays with room for twice as many edges.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::setEdge(int fromNode, int toNode, int weight)
+{
+    // A view can not be changed, so it is copied first
+    copyView();
+
+    // If the edge already exists, only its weight is changed
+    int edge = findEdge(fromNode, toNode);
+
+    if (edge != -1)
+    {
+        weights[edge] = weight;
+        return;
+    }
+
+    // Otherwise the edge is inserted at the end of the edges of the source node
+    spreadRows();
+
+    if (rowEnds[fromNode] == rowLimits[fromNode])
+    {
+        moveRowToEnd(fromNode);
+    }
+
+    int slot = rowEnds[fromNode]++;
+    targets[slot] = toNode;
+    weights[slot] = weight;
+    edges++;
+
+    // The rows are moved back together once more slots are unused than hold an edge
+    if (targets.size() - edges > static_cast<size_t>(edges) + nodes)
+    {
+        compact();
+    }
+    useOwnArrays();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[removeEdge]--------------------------------------------
+// Description: The removeEdge method removes the edge from the source node to the
+// destination node and returns true, or returns false if there is no such edge.
+// -------------------------------------------------------------------------------------------
+bool CsrGraph::removeEdge(int fromNode, int toNode)
+{
+    int edge = findEdge(fromNode, toNode);
+
+    if (edge == -1)
+    {
+        return false;
+    }
+
+    // The edges after it in its row are moved down by one, leaving an unused slot at the end
+    // of the row
+    copyView();
+    spreadRows();
+    copy(targets.begin() + edge + 1, targets.begin() + rowEnds[fromNode], targets.begin() + edge);
+    copy(weights.begin() + edge + 1, weights.begin() + rowEnds[fromNode], weights.begin() + edge);
+    rowEnds[fromNode]--;
+    edges--;
+
+    if (targets.size() - edges > static_cast<size_t>(edges) + nodes)
+    {
+        compact();
+    }
+    useOwnArrays();
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[useOwnArrays]--------------------------------------------
+// Description: The useOwnArrays method points the arrays read by the accessor methods at the
+// graph's own vectors, it is called whenever the vectors may have moved.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::useOwnArrays()
+{
+    offsetArray = offsets.data();
+    endArray = isCompact() ? offsets.data() + 1 : rowEnds.data();
+    targetArray = targets.data();
+    weightArray = weights.data();
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[copyView]-----------------------------------------------
+// Description: The copyView method copies the arrays of a view into the graph's own vectors
+// and lets go of the viewed memory, it does nothing if the graph is not a view.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::copyView()
+{
+    if (!viewOwner)
+    {
+        return;
+    }
+
+    offsets.assign(offsetArray, offsetArray + nodes + 2);
+    targets.assign(targetArray, targetArray + edges);
+    weights.assign(weightArray, weightArray + edges);
+    viewOwner.reset();
+    useOwnArrays();
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[spreadRows]---------------------------------------------
+// Description: The spreadRows method gives every row of a compact graph its own end and limit,
+// both where the next row begins, so that a row can grow or shrink without moving the rows
+// after it. It does nothing if the graph is not compact.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::spreadRows()
+{
+    if (!isCompact())
+    {
+        return;
+    }
+
+    rowEnds.assign(offsets.begin() + 1, offsets.end());
+    rowLimits = rowEnds;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[moveRowToEnd]--------------------------------------------
+// Description: The moveRowToEnd method copies the edges of the node to the end of the arrays,
+// with room for twice as many edges, and leaves the old slots of the row unused.
+// -------------------------------------------------------------------------------------------
+void CsrGraph::moveRowToEnd(int fromNode)
+{
+    int rowBegin = offsets[fromNode];
+    int rowSize = rowEnds[fromNode] - rowBegin;
+    int newBegin = static_cast<int>(targets.size());
+    int newSlots = max(2 * rowSize, MIN_ROW_SLOTS);
+
+    targets.resize(newBegin + newSlots);
+    weights.resize(newBegin + newSlots);
+    copy(targets.begin() + rowBegin, targets.begin() + rowBegin + rowSize, targets.begin() + newBegin);
+    copy(weights.begin() + rowBegin, weights.begin() + rowBegin + rowSize, weights.begin() + newBegin);
+
+    offsets[fromNode] = newBegin;
+    rowEnds[fromNode] = newBegin + rowSize;
+    rowLimits[fromNode] = newBegin + newSlots;
+}
+// -------------------------------------------------------------------------------------------
@@ -0,0 +1,191 @@
+// ----------------------------- csrgraph.h ----------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The csrgraph.h file is the header file for the CsrGraph
+// class, which stores the edges of a directed graph in compressed sparse
+// row (CSR) form. It is the edge storage shared by the GraphM class for
+// Dijkstra's shortest path algorithm and the GraphL class for the
+// depth-first search.
+// ---------------------------------------------------------------------
+// Notes - The edges of node n are stored next to each other in the
+// targets and weights arrays, from subscript offsets[n] up to (but not
+// including) offsets[n + 1], so walking the edges of a node is a
+// sequential scan over two contiguous arrays instead of following a
+// pointer for every edge. Nodes are numbered from 1 to nodeCount like in
+// the input data files and subscript 0 is an empty row. The graph is
+// built once from a list of edges, the edges of each node keep the order
+// they have in that list. A graph can also be a view of arrays that it
+// does not own, such as the arrays of a memory mapped snapshot file, the
+// view is copied into the graph's own arrays the first time an edge is
+// changed. Once an edge has been inserted or removed each row may have
+// unused slots after its last edge, so the end of node n's edges is kept
+// in a separate array instead of being read from offsets[n + 1], and the
+// rows are only laid out back to back again by compact. The accessor
+// methods used by the graph algorithms are defined inline at the end of
+// this file.
+// ---------------------------------------------------------------------
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+#include <vector>
+#include <memory>
+using namespace std;
+
+// The CsrEdge struct represents one edge used to build a CsrGraph
+struct CsrEdge
+{
+    int fromNode;
+    int toNode;
+    int weight;
+};
+
+class CsrGraph {
+
+    public:
+        // CsrGraph constructor creates a graph with no nodes and no edges
+        CsrGraph();
+
+        // Copy constructor and assignment operator, a copy of a view shares the viewed arrays
+        CsrGraph(const CsrGraph& other);
+        CsrGraph& operator=(const CsrGraph& other);
+
+        // build replaces the graph with the given nodes and edges, if keepParallelEdges is false
+        // an edge that appears more than once keeps its first position and its last weight
+        void build(int nodeCount, const vector<CsrEdge>& edgeList, bool keepParallelEdges);
+
+        // buildReverse replaces the graph with a copy of the given graph with every edge reversed
+        void buildReverse(const CsrGraph& graph);
+
+        // view replaces the graph with a view of arrays laid out like the arrays of the graph,
+        // owner keeps the memory of the arrays alive for as long as the graph uses it
+        void view(int nodeCount, int edgeCount, const int* offsetArray, const int* targetArray,
+                  const int* weightArray, shared_ptr<const void> owner);
+
+        // isCompact returns true if the rows are stored back to back with no unused slots, and
+        // compact moves them back together after edges have been inserted or removed
+        bool isCompact() const;
+        void compact();
+
+        // Methods for getting the arrays of the graph, used to write them to a file, they are
+        // only laid out as CSR arrays while the graph is compact
+        const int* offsetData() const;
+        const int* targetData() const;
+        const int* weightData() const;
+
+        // Methods for getting the number of nodes and edges in the graph
+        int nodeCount() const;
+        int edgeCount() const;
+
+        // Methods for walking the edges of a node, the edges of fromNode are the
+        // subscripts beginEdge(fromNode) up to but not including endEdge(fromNode)
+        int beginEdge(int fromNode) const;
+        int endEdge(int fromNode) const;
+        int edgeTarget(int edge) const;
+        int edgeWeight(int edge) const;
+
+        // findEdge returns the subscript of the edge from fromNode to toNode, or -1 if there is none
+        int findEdge(int fromNode, int toNode) const;
+
+        // checksum returns a hash of the edges of every node, so that a file written for one graph
+        // can be told apart from a file written for another graph with as many nodes and edges
+        unsigned long long checksum() const;
+
+        // Methods for changing the weight of an edge, inserting an edge or removing an edge
+        void setEdge(int fromNode, int toNode, int weight);
+        bool removeEdge(int fromNode, int toNode);
+
+    private:
+        // Number of nodes and edges in the graph
+        int nodes;
+        int edges;
+
+        // Subscript of the first edge of each node, offsets[nodes + 1] is the number of edges
+        // while the graph is compact
+        vector<int> offsets;
+
+        // Subscript one past the last edge and one past the last slot of each node's row, both
+        // are empty while the graph is compact and the rows end where the next row begins
+        vector<int> rowEnds;
+        vector<int> rowLimits;
+
+        // Destination node and weight of every edge, grouped by source node, the slots after
+        // the edges of a row that is not compact hold no edge
+        vector<int> targets;
+        vector<int> weights;
+
+        // The arrays read by the accessor methods, they point at the vectors above or at
+        // the arrays of a view
+        const int* offsetArray;
+        const int* endArray;
+        const int* targetArray;
+        const int* weightArray;
+
+        // Owner of the memory of a view, empty when the graph uses its own vectors
+        shared_ptr<const void> viewOwner;
+
+        // Helper methods that point the arrays at the vectors, that copy a view into the
+        // vectors before an edge is changed, that give every row its own end and limit before
+        // an edge is inserted or removed, and that move a full row to the end of the arrays
+        void useOwnArrays();
+        void copyView();
+        void spreadRows();
+        void moveRowToEnd(int fromNode);
+};
+
+// ----------------------------------[nodeCount]----------------------------------------------
+// Description: The nodeCount method returns the number of nodes in the graph.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::nodeCount() const
+{
+    return nodes;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[edgeCount]----------------------------------------------
+// Description: The edgeCount method returns the number of edges in the graph.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::edgeCount() const
+{
+    return edges;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[beginEdge]----------------------------------------------
+// Description: The beginEdge method returns the subscript of the first edge of the node.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::beginEdge(int fromNode) const
+{
+    return offsetArray[fromNode];
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[endEdge]-----------------------------------------------
+// Description: The endEdge method returns the subscript one past the last edge of the node.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::endEdge(int fromNode) const
+{
+    return endArray[fromNode];
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[edgeTarget]---------------------------------------------
+// Description: The edgeTarget method returns the destination node of the edge.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::edgeTarget(int edge) const
+{
+    return targetArray[edge];
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[edgeWeight]---------------------------------------------
+// Description: The edgeWeight method returns the weight of the edge.
+// -------------------------------------------------------------------------------------------
+inline int CsrGraph::edgeWeight(int edge) const
+{
+    return weightArray[edge];
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
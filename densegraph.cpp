@@ -0,0 +1,373 @@
+// --------------------------- densegraph.cpp --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The densegraph.cpp file is the implementation file for the
+// DenseGraph class. It contains the scalar, SSE4.1 and AVX2 versions of
+// the two kernels of Dijkstra's algorithm over a dense matrix, the code
+// that picks one of them at run time, and the methods of the class.
+// ---------------------------------------------------------------------
+// Notes - The SIMD kernels are compiled with the target attribute of GCC
+// and Clang, so the file is built without any extra compiler flags and the
+// instructions are only run after the processor has been checked for them.
+// Additions saturate like the WeightTraits additions of the heap version, a
+// sum past INT_MAX is INT_MAX and a sum below INT_MIN is INT_MIN. Every
+// row of the matrix and every scratch array is a whole number of 8-int
+// vectors long, the padding holds nodes that can never be picked.
+// ---------------------------------------------------------------------
+#include "densegraph.h"
+#include <vector>
+#include <climits>
+#include <algorithm>
+using namespace std;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DENSE_GRAPH_SIMD
+#include <immintrin.h>
+#endif
+
+// Number of ints the rows of the matrix and the scratch arrays are rounded up to
+const int DENSE_VECTOR_WIDTH = 8;
+
+// The DenseKernels struct holds one version of the kernels. minimumIndex returns the subscript
+// of the smallest key, the first one on ties. relaxRow lowers the key of every open node that
+// the weights row has an edge to, if the distance plus the weight is shorter, and sets the
+// path entry of those nodes to node.
+struct DenseKernels
+{
+    const char* name;
+    int (*minimumIndex)(const int* keys, int count);
+    void (*relaxRow)(const int* weights, const int* open, int* keys, int* paths, int count, int distance, int node);
+};
+
+// -------------------------------[scalarMinimumIndex]----------------------------------------
+// Description: The scalarMinimumIndex function is the version of minimumIndex for processors
+// without SIMD instructions.
+// -------------------------------------------------------------------------------------------
+static int scalarMinimumIndex(const int* keys, int count)
+{
+    int best = 0;
+
+    for (int index = 1; index < count; index++)
+    {
+        if (keys[index] < keys[best])
+        {
+            best = index;
+        }
+    }
+    return best;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[scalarRelaxRow]------------------------------------------
+// Description: The scalarRelaxRow function is the version of relaxRow for processors without
+// SIMD instructions.
+// -------------------------------------------------------------------------------------------
+static void scalarRelaxRow(const int* weights, const int* open, int* keys, int* paths, int count, int distance, int node)
+{
+    // A sum that overflows has the sign of neither of its halves and is replaced by the
+    // limit on the side of the distance
+    int saturated = distance < 0 ? INT_MIN : INT_MAX;
+
+    // The loop has no branches so that the compiler can vectorize it where it is able to
+    for (int index = 0; index < count; index++)
+    {
+        int newDistance = static_cast<int>(static_cast<unsigned>(distance) + static_cast<unsigned>(weights[index]));
+        newDistance = ((distance ^ newDistance) & (weights[index] ^ newDistance)) < 0 ? saturated : newDistance;
+        bool update = open[index] != 0 && weights[index] != INT_MAX && newDistance < keys[index];
+        keys[index] = update ? newDistance : keys[index];
+        paths[index] = update ? node : paths[index];
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+#ifdef DENSE_GRAPH_SIMD
+
+// --------------------------------[sseMinimumIndex]------------------------------------------
+// Description: The sseMinimumIndex function is the SSE4.1 version of minimumIndex. Each of the
+// 4 lanes keeps the smallest key it has seen and its subscript, a lane only takes a key that
+// is strictly smaller so it keeps the first one, then the lanes are compared at the end.
+// -------------------------------------------------------------------------------------------
+__attribute__((target("sse4.1")))
+static int sseMinimumIndex(const int* keys, int count)
+{
+    __m128i bestKeys = _mm_set1_epi32(INT_MAX);
+    __m128i bestIndexes = _mm_setzero_si128();
+    __m128i indexes = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i step = _mm_set1_epi32(4);
+
+    for (int index = 0; index < count; index += 4)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + index));
+        __m128i smaller = _mm_cmplt_epi32(values, bestKeys);
+        bestKeys = _mm_blendv_epi8(bestKeys, values, smaller);
+        bestIndexes = _mm_blendv_epi8(bestIndexes, indexes, smaller);
+        indexes = _mm_add_epi32(indexes, step);
+    }
+
+    int laneKeys[4];
+    int laneIndexes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(laneKeys), bestKeys);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(laneIndexes), bestIndexes);
+
+    int best = 0;
+
+    for (int lane = 1; lane < 4; lane++)
+    {
+        if (laneKeys[lane] < laneKeys[best] || (laneKeys[lane] == laneKeys[best] && laneIndexes[lane] < laneIndexes[best]))
+        {
+            best = lane;
+        }
+    }
+    return laneIndexes[best];
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[sseRelaxRow]--------------------------------------------
+// Description: The sseRelaxRow function is the SSE4.1 version of relaxRow. The new distances
+// of 4 nodes are computed at once, the lanes that overflow are set to the limit on the side
+// of the distance, and blend instructions keep the old key and path entry in the lanes that
+// are closed, have no edge or do not get a shorter distance.
+// -------------------------------------------------------------------------------------------
+__attribute__((target("sse4.1")))
+static void sseRelaxRow(const int* weights, const int* open, int* keys, int* paths, int count, int distance, int node)
+{
+    __m128i distances = _mm_set1_epi32(distance);
+    __m128i nodes = _mm_set1_epi32(node);
+    __m128i noEdge = _mm_set1_epi32(INT_MAX);
+    __m128i saturated = _mm_set1_epi32(distance < 0 ? INT_MIN : INT_MAX);
+
+    for (int index = 0; index < count; index += 4)
+    {
+        __m128i edgeWeights = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + index));
+        __m128i openLanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(open + index));
+        __m128i oldKeys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + index));
+        __m128i oldPaths = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paths + index));
+
+        __m128i newKeys = _mm_add_epi32(distances, edgeWeights);
+        __m128i overflow = _mm_and_si128(_mm_xor_si128(distances, newKeys), _mm_xor_si128(edgeWeights, newKeys));
+        newKeys = _mm_blendv_epi8(newKeys, saturated, _mm_srai_epi32(overflow, 31));
+        __m128i shorter = _mm_cmplt_epi32(newKeys, oldKeys);
+        __m128i missing = _mm_cmpeq_epi32(edgeWeights, noEdge);
+        __m128i update = _mm_and_si128(openLanes, _mm_andnot_si128(missing, shorter));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(keys + index), _mm_blendv_epi8(oldKeys, newKeys, update));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(paths + index), _mm_blendv_epi8(oldPaths, nodes, update));
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[avxMinimumIndex]------------------------------------------
+// Description: The avxMinimumIndex function is the AVX2 version of minimumIndex, it works like
+// sseMinimumIndex with 8 lanes.
+// -------------------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static int avxMinimumIndex(const int* keys, int count)
+{
+    __m256i bestKeys = _mm256_set1_epi32(INT_MAX);
+    __m256i bestIndexes = _mm256_setzero_si256();
+    __m256i indexes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i step = _mm256_set1_epi32(8);
+
+    for (int index = 0; index < count; index += 8)
+    {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + index));
+        __m256i smaller = _mm256_cmpgt_epi32(bestKeys, values);
+        bestKeys = _mm256_blendv_epi8(bestKeys, values, smaller);
+        bestIndexes = _mm256_blendv_epi8(bestIndexes, indexes, smaller);
+        indexes = _mm256_add_epi32(indexes, step);
+    }
+
+    int laneKeys[8];
+    int laneIndexes[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(laneKeys), bestKeys);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(laneIndexes), bestIndexes);
+
+    int best = 0;
+
+    for (int lane = 1; lane < 8; lane++)
+    {
+        if (laneKeys[lane] < laneKeys[best] || (laneKeys[lane] == laneKeys[best] && laneIndexes[lane] < laneIndexes[best]))
+        {
+            best = lane;
+        }
+    }
+    return laneIndexes[best];
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[avxRelaxRow]--------------------------------------------
+// Description: The avxRelaxRow function is the AVX2 version of relaxRow, it works like
+// sseRelaxRow with 8 lanes.
+// -------------------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void avxRelaxRow(const int* weights, const int* open, int* keys, int* paths, int count, int distance, int node)
+{
+    __m256i distances = _mm256_set1_epi32(distance);
+    __m256i nodes = _mm256_set1_epi32(node);
+    __m256i noEdge = _mm256_set1_epi32(INT_MAX);
+    __m256i saturated = _mm256_set1_epi32(distance < 0 ? INT_MIN : INT_MAX);
+
+    for (int index = 0; index < count; index += 8)
+    {
+        __m256i edgeWeights = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + index));
+        __m256i openLanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open + index));
+        __m256i oldKeys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + index));
+        __m256i oldPaths = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(paths + index));
+
+        __m256i newKeys = _mm256_add_epi32(distances, edgeWeights);
+        __m256i overflow = _mm256_and_si256(_mm256_xor_si256(distances, newKeys), _mm256_xor_si256(edgeWeights, newKeys));
+        newKeys = _mm256_blendv_epi8(newKeys, saturated, _mm256_srai_epi32(overflow, 31));
+        __m256i shorter = _mm256_cmpgt_epi32(oldKeys, newKeys);
+        __m256i missing = _mm256_cmpeq_epi32(edgeWeights, noEdge);
+        __m256i update = _mm256_and_si256(openLanes, _mm256_andnot_si256(missing, shorter));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + index), _mm256_blendv_epi8(oldKeys, newKeys, update));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(paths + index), _mm256_blendv_epi8(oldPaths, nodes, update));
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
+
+// ----------------------------------[pickKernels]--------------------------------------------
+// Description: The pickKernels function returns the fastest version of the kernels that the
+// processor can run.
+// -------------------------------------------------------------------------------------------
+static DenseKernels pickKernels()
+{
+#ifdef DENSE_GRAPH_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return {"avx2", avxMinimumIndex, avxRelaxRow};
+    }
+
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return {"sse4.1", sseMinimumIndex, sseRelaxRow};
+    }
+#endif
+
+    return {"scalar", scalarMinimumIndex, scalarRelaxRow};
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[kernels]-----------------------------------------------
+// Description: The kernels function returns the kernels picked by pickKernels, they are only
+// picked the first time it is called.
+// -------------------------------------------------------------------------------------------
+static const DenseKernels& kernels()
+{
+    static const DenseKernels picked = pickKernels();
+    return picked;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The DenseGraph constructor creates a graph with no nodes.
+// -------------------------------------------------------------------------------------------
+DenseGraph::DenseGraph()
+{
+    nodes = 0;
+    stride = DENSE_VECTOR_WIDTH;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[build]------------------------------------------------
+// Description: The build method fills in the matrix from the edges of the CSR graph, if the
+// graph has more than one edge between two nodes the lowest weight is kept since it is the
+// only one Dijkstra's algorithm can use.
+// -------------------------------------------------------------------------------------------
+void DenseGraph::build(const CsrGraph& graph)
+{
+    nodes = graph.nodeCount();
+    stride = (nodes + DENSE_VECTOR_WIDTH) / DENSE_VECTOR_WIDTH * DENSE_VECTOR_WIDTH;
+    weights.assign(static_cast<size_t>(nodes + 1) * stride, INT_MAX);
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        int* row = weights.data() + static_cast<size_t>(node) * stride;
+
+        for (int edge = graph.beginEdge(node); edge < graph.endEdge(node); edge++)
+        {
+            row[graph.edgeTarget(edge)] = min(row[graph.edgeTarget(edge)], graph.edgeWeight(edge));
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method throws the matrix away and releases its memory.
+// -------------------------------------------------------------------------------------------
+void DenseGraph::clear()
+{
+    nodes = 0;
+    stride = DENSE_VECTOR_WIDTH;
+    vector<int>().swap(weights);
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[shortestPaths]--------------------------------------------
+// Description: The shortestPaths method runs Dijkstra's algorithm from the source node over
+// the matrix. The key of a node is its distance while it is open (reached or not, but not
+// visited yet) and infinity once it has been visited, so the next node to visit is the one
+// with the smallest key, and the search ends when the smallest key is infinity. The distance
+// of each node is written to the row when it is visited, and the path entries at the end.
+// -------------------------------------------------------------------------------------------
+void DenseGraph::shortestPaths(int sourceNode, TableRow& row, DenseWorkspace& workspace) const
+{
+    const DenseKernels& kernel = kernels();
+
+    // Nodes 1 to nodes start open, at a distance of infinity and with a path entry of 0
+    workspace.keys.assign(stride, INT_MAX);
+    workspace.paths.assign(stride, 0);
+    workspace.open.assign(stride, 0);
+    fill(workspace.open.begin() + 1, workspace.open.begin() + nodes + 1, -1);
+
+    int* keys = workspace.keys.data();
+    int* paths = workspace.paths.data();
+    int* open = workspace.open.data();
+
+    row.reset(nodes);
+    keys[sourceNode] = 0;
+
+    while (true)
+    {
+        // The open node with the shortest distance is visited, the smaller node number on ties
+        int currentNode = kernel.minimumIndex(keys, stride);
+        int distance = keys[currentNode];
+
+        if (distance == INT_MAX)
+        {
+            break;
+        }
+
+        row.setDistance(currentNode, distance);
+        row.setVisited(currentNode, true);
+        keys[currentNode] = INT_MAX;
+        open[currentNode] = 0;
+
+        // The edges of the current node are relaxed with one pass over its row of the matrix
+        kernel.relaxRow(weights.data() + static_cast<size_t>(currentNode) * stride, open, keys, paths, stride, distance, currentNode);
+    }
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        row.setPath(node, paths[node]);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[kernelName]---------------------------------------------
+// Description: The kernelName method returns "avx2", "sse4.1" or "scalar", the name of the
+// kernels that shortestPaths uses on this processor.
+// -------------------------------------------------------------------------------------------
+const char* DenseGraph::kernelName()
+{
+    return kernels().name;
+}
+// -------------------------------------------------------------------------------------------
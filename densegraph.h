@@ -0,0 +1,67 @@
+// ---------------------------- densegraph.h ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The densegraph.h file is the header file for the DenseGraph
+// class, which stores the edge weights of a graph in a full matrix and
+// runs Dijkstra's shortest path algorithm over it with vector (SIMD)
+// instructions. GraphM uses it for its dense engine, which is faster than
+// the heap over the CSR graph when almost every pair of nodes has an edge.
+// ---------------------------------------------------------------------
+// Notes - Each step of the algorithm scans a whole row, the unvisited
+// node with the shortest distance is found with a vectorized minimum and
+// the edges of the visited node are relaxed with a vectorized masked
+// min-plus update of the row, so a row takes O(V^2 / lanes) time. The
+// kernels are chosen once at run time: AVX2 with 8 lanes, SSE4.1 with 4
+// lanes, or plain scalar loops on other processors and compilers. Every
+// kernel gives the same row of T as the heap, ties between distances
+// are broken by the smaller node number. The matrix takes (V + 1) times
+// (V + 1) ints, rounded up to whole vectors, and a missing edge has a
+// weight of INT_MAX.
+// ---------------------------------------------------------------------
+#ifndef DENSE_GRAPH_H
+#define DENSE_GRAPH_H
+#include "csrgraph.h"
+#include "tablerow.h"
+#include <vector>
+using namespace std;
+
+// The DenseWorkspace struct holds the scratch arrays of one search, a thread reuses the same
+// workspace for every source node so the arrays are only allocated once
+struct DenseWorkspace
+{
+    vector<int> keys;
+    vector<int> paths;
+    vector<int> open;
+};
+
+class DenseGraph {
+
+    public:
+        // DenseGraph constructor creates a graph with no nodes
+        DenseGraph();
+
+        // build fills in the matrix from the edges of a CSR graph
+        void build(const CsrGraph& graph);
+
+        // clear throws the matrix away
+        void clear();
+
+        // shortestPaths runs Dijkstra's algorithm from the source node and fills in the row
+        void shortestPaths(int sourceNode, TableRow& row, DenseWorkspace& workspace) const;
+
+        // kernelName returns the name of the kernels picked for this processor
+        static const char* kernelName();
+
+    private:
+        // Number of nodes, and the number of ints in each row of the matrix
+        int nodes;
+        int stride;
+
+        // Weight of the edge from node i to node j at subscript i * stride + j
+        vector<int> weights;
+};
+
+#endif
@@ -0,0 +1,203 @@
+// -------------------------- floydwarshall.cpp ------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The floydwarshall.cpp file is the implementation file for the
+// FloydWarshall class. It contains the blocked version of the algorithm,
+// the code that relaxes one tile, and the helper that shares the tiles of
+// a step out between threads.
+// ---------------------------------------------------------------------
+// Notes - A tile is relaxed with the intermediate node loop on the
+// outside, which is the order of the plain algorithm, so it is still
+// correct for the tiles of the first two steps that are relaxed against
+// themselves. The innermost loop walks along a row of two tiles and has no
+// branches, so the compiler can vectorize it. With GCC on x86-64 Linux the
+// function that relaxes a tile is also built for AVX2, and the version the
+// processor supports is picked at run time.
+// ---------------------------------------------------------------------
+#include "floydwarshall.h"
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <functional>
+using namespace std;
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define FLOYD_WARSHALL_CLONES
+#endif
+
+// Number of nodes along each side of a tile, a tile of ints takes 16 KB
+const int TILE_SIZE = 64;
+
+// --------------------------------[runInParallel]--------------------------------------------
+// Description: The runInParallel function runs task for every number from 0 up to but not
+// including taskCount, using up to threadCount threads. The calling thread also runs tasks,
+// and the function returns once all of them are done.
+// -------------------------------------------------------------------------------------------
+static void runInParallel(int taskCount, int threadCount, const function<void(int)>& task)
+{
+    atomic<int> nextTask(0);
+
+    // Each thread takes the next task until there are none left
+    auto worker = [&nextTask, taskCount, &task]
+    {
+        for (int taskIndex = nextTask++; taskIndex < taskCount; taskIndex = nextTask++)
+        {
+            task(taskIndex);
+        }
+    };
+
+    vector<thread> workers;
+
+    for (int workerIndex = 1; workerIndex < min(threadCount, taskCount); workerIndex++)
+    {
+        workers.emplace_back(worker);
+    }
+
+    worker();
+
+    for (thread& workerThread : workers)
+    {
+        workerThread.join();
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[minPlusTile]---------------------------------------------
+// Description: The minPlusTile function relaxes one tile of the matrix with each of the
+// intermediate nodes of a block. target, toMiddle and fromMiddle point at the first entry
+// of the three tiles, and stride is the length of a row of the matrix. On processors with
+// AVX2 a second copy of the function built for it is picked when the program starts.
+// -------------------------------------------------------------------------------------------
+#ifdef FLOYD_WARSHALL_CLONES
+__attribute__((target_clones("avx2", "default")))
+#endif
+static void minPlusTile(int* target, const int* toMiddle, const int* fromMiddle, int stride)
+{
+    // The row of the intermediate node is copied out first, so the compiler knows that it is not
+    // written by the inner loop and can vectorize it. The only row of the tile that can be the
+    // same row is the intermediate node's own, which does not change since its distance to
+    // itself is 0.
+    int middleRow[TILE_SIZE];
+
+    for (int middle = 0; middle < TILE_SIZE; middle++)
+    {
+        copy(fromMiddle + static_cast<size_t>(middle) * stride, fromMiddle + static_cast<size_t>(middle) * stride + TILE_SIZE, middleRow);
+
+        for (int row = 0; row < TILE_SIZE; row++)
+        {
+            int firstHalf = toMiddle[static_cast<size_t>(row) * stride + middle];
+            int* targetRow = target + static_cast<size_t>(row) * stride;
+
+            for (int column = 0; column < TILE_SIZE; column++)
+            {
+                targetRow[column] = min(targetRow[column], firstHalf + middleRow[column]);
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The FloydWarshall constructor creates an empty distance matrix.
+// -------------------------------------------------------------------------------------------
+FloydWarshall::FloydWarshall()
+{
+    nodes = 0;
+    stride = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[run]-------------------------------------------------
+// Description: The run method fills the distance matrix with the edges of the graph and runs
+// the blocked Floyd-Warshall algorithm over it. For each block of intermediate nodes the tile
+// on the diagonal is relaxed first, then the other tiles in its row and column, which only
+// need the diagonal tile, and last every remaining tile, which needs one tile from each of
+// those. The tiles of the last two steps are shared out between the threads.
+// -------------------------------------------------------------------------------------------
+void FloydWarshall::run(const CsrGraph& graph, int threadCount)
+{
+    nodes = graph.nodeCount();
+    stride = (nodes + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE;
+    distances.assign(static_cast<size_t>(stride) * stride, UNREACHABLE);
+
+    // Every node is at a distance of 0 from itself, and each edge is a path of one edge
+    for (int node = 0; node < stride; node++)
+    {
+        distances[static_cast<size_t>(node) * stride + node] = 0;
+    }
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        for (int edge = graph.beginEdge(node); edge < graph.endEdge(node); edge++)
+        {
+            int& entry = distances[static_cast<size_t>(node - 1) * stride + graph.edgeTarget(edge) - 1];
+            entry = min(entry, graph.edgeWeight(edge));
+        }
+    }
+
+    int tiles = stride / TILE_SIZE;
+
+    for (int block = 0; block < tiles; block++)
+    {
+        // The tile on the diagonal only depends on itself
+        relaxTile(block, block, block);
+
+        // The other tiles in the block's row and column, the first tiles - 1 tasks are the row
+        runInParallel(2 * (tiles - 1), threadCount, [this, block, tiles](int task)
+        {
+            int other = task % (tiles - 1);
+            other += other >= block ? 1 : 0;
+
+            if (task < tiles - 1)
+            {
+                relaxTile(block, other, block);
+            }
+            else
+            {
+                relaxTile(other, block, block);
+            }
+        });
+
+        // Every tile outside of the block's row and column
+        runInParallel((tiles - 1) * (tiles - 1), threadCount, [this, block, tiles](int task)
+        {
+            int tileRow = task / (tiles - 1);
+            int tileColumn = task % (tiles - 1);
+            tileRow += tileRow >= block ? 1 : 0;
+            tileColumn += tileColumn >= block ? 1 : 0;
+            relaxTile(tileRow, tileColumn, block);
+        });
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[relaxTile]----------------------------------------------
+// Description: The relaxTile method relaxes the tile at tileRow and tileColumn with each of
+// the intermediate nodes of the block: the distance from i to j becomes the distance from i
+// to k plus the distance from k to j if that is shorter. The distances from i to k are in the
+// tile at tileRow and block, and the distances from k to j in the tile at block and tileColumn.
+// -------------------------------------------------------------------------------------------
+void FloydWarshall::relaxTile(int tileRow, int tileColumn, int block)
+{
+    int* matrix = distances.data();
+    minPlusTile(matrix + static_cast<size_t>(tileRow) * TILE_SIZE * stride + tileColumn * TILE_SIZE,
+                matrix + static_cast<size_t>(tileRow) * TILE_SIZE * stride + block * TILE_SIZE,
+                matrix + static_cast<size_t>(block) * TILE_SIZE * stride + tileColumn * TILE_SIZE, stride);
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method throws the distance matrix away and releases its memory.
+// -------------------------------------------------------------------------------------------
+void FloydWarshall::clear()
+{
+    nodes = 0;
+    stride = 0;
+    vector<int>().swap(distances);
+}
+// -------------------------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+// --------------------------- floydwarshall.h -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The floydwarshall.h file is the header file for the
+// FloydWarshall class, which finds the shortest distance between every
+// pair of nodes of a graph with the Floyd-Warshall algorithm. GraphM
+// uses it for its Floyd-Warshall engine, which fills in all of T at once
+// instead of running Dijkstra's algorithm from every source node.
+// ---------------------------------------------------------------------
+// Notes - The distance matrix is split into square tiles that fit in the
+// processor's cache, and the algorithm is run one block of intermediate
+// nodes at a time: first the tile on the diagonal, then the tiles in its
+// row and column, then every other tile. The tiles of the last two steps
+// do not depend on each other, so they are shared out between threads.
+// Unreachable pairs are kept at half of INT_MAX so that adding two of them
+// can not overflow, the caller has to make sure every real distance is
+// below that. Only distances are computed, GraphM picks the path entries
+// from them afterwards.
+// ---------------------------------------------------------------------
+#ifndef FLOYD_WARSHALL_H
+#define FLOYD_WARSHALL_H
+#include "csrgraph.h"
+#include <vector>
+#include <climits>
+using namespace std;
+
+class FloydWarshall {
+
+    public:
+        // Distance used for pairs of nodes with no path, every real distance must be below it
+        static constexpr int UNREACHABLE = INT_MAX / 2;
+
+        // FloydWarshall constructor creates an empty distance matrix
+        FloydWarshall();
+
+        // run finds the shortest distances between all of the nodes of the graph using threadCount
+        // threads, the graph can not have edges with a weight of 0 or less
+        void run(const CsrGraph& graph, int threadCount);
+
+        // distance returns the shortest distance from fromNode to toNode, or INT_MAX if there is no path
+        int distance(int fromNode, int toNode) const;
+
+        // clear throws the distance matrix away
+        void clear();
+
+    private:
+        // Number of nodes, and the number of ints in each row of the matrix, a multiple of the tile size
+        int nodes;
+        int stride;
+
+        // Shortest distance from node i + 1 to node j + 1 at subscript i * stride + j
+        vector<int> distances;
+
+        // Helper method that relaxes one tile with the intermediate nodes of a block, the tiles are
+        // given by their tile row and tile column
+        void relaxTile(int tileRow, int tileColumn, int block);
+};
+
+// -----------------------------------[distance]----------------------------------------------
+// Description: The distance method returns the shortest distance between the two nodes, or
+// infinity (INT_MAX) if there is no path between them.
+// -------------------------------------------------------------------------------------------
+inline int FloydWarshall::distance(int fromNode, int toNode) const
+{
+    int value = distances[static_cast<size_t>(fromNode - 1) * stride + toNode - 1];
+    return value >= UNREACHABLE ? INT_MAX : value;
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
@@ -2,21 +2,21 @@
 // David Schurer
 // CSS 343
 // Creation Date: 4/27/2023
-// Date of Last Modification: 5/5/2023
+// Date of Last Modification: 10/17/2026
 // ---------------------------------------------------------------------
 // Purpose - The graphl.cpp file is the implementation file for the
 // GraphL class, which is the implementation of a depth-first search
 // traversal of a graph. This implementation file contains the
-// implementation for the methods buildGraph, displayGraph, depthFirstSearch,
-// and its helper method depthFirstSearchHelper as well as the class
-// constructor and destructor.
+// implementation for the methods buildGraph, saveSnapshot, loadSnapshot,
+// displayGraph, depthFirstSearch, depthFirstOrdering and its helper method
+// depthFirstSearchHelper, depthFirstTimes, topologicalOrder and the two
+// connected components methods as well as the class constructor and destructor.
 // ---------------------------------------------------------------------
 // Notes - The buildGraph method of the GraphL class reads in a text file
 // that contains the data for building the graph, which is constructed
-// by using adjacency lists. Additionally, the constructor of the class
-// initializes the data members for the nodes in the graph through the use
-// of a range-based for loop. The depthFirstSearch method performs a
-// depth-first search traversal of the graph using recursion, it keeps
+// by using adjacency lists stored as a compressed sparse row graph, the array
+// of nodes is sized from the number of nodes read in from the file. The depthFirstSearch method performs a
+// depth-first search traversal of the graph using an explicit stack, it keeps
 // track of the nodes that it needs to visit and explores the graph
 // by going as far along it can through each branch before backtracking
 // and exploring another branch.
@@ -26,75 +26,141 @@
 #include <fstream>
 #include <vector>
 #include <iomanip>
-#include <stack>
+#include <memory>
 #include <climits>
+#include <algorithm>
 using namespace std;
 
-// ----------------------------------[Constructor]--------------------------------------------
-// Description: The GraphL constructor initializes all of the graph node's
-// data members to their default values. It uses a range-based for loop to iterate
-// through all of the elements in the graphNodes array.
-// -------------------------------------------------------------------------------------------
-GraphL::GraphL() 
+// The OrderingVisitor struct is the visitor of depthFirstTraversal for depthFirstOrdering, it
+// adds each node to the ordering when it is visited
+struct OrderingVisitor
 {
-    // Initializes all of the elements in the graphNodes array to their default values
-    for (auto& graphNode : graphNodes)
+    vector<int>& ordering;
+
+    void discover(int node)
     {
-        // edgeHead is initialized to nullptr
-        graphNode.edgeHead = nullptr;
+        ordering.push_back(node);
+    }
+
+    void revisit(int, int) {}
+    void finish(int, int) {}
+};
 
-        // Data of the node is initialized to nullptr
-        graphNode.data = nullptr;
+// The TimeVisitor struct is the visitor for depthFirstTimes, the clock goes up by one at each
+// visit and each pop
+struct TimeVisitor
+{
+    vector<int>& discoveryTime;
+    vector<int>& finishTime;
+    int clock;
 
-        // Visited status initialized to false
-        graphNode.visited = false;
+    void discover(int node)
+    {
+        discoveryTime[node] = ++clock;
     }
 
-    // The graph's size is initialized to 0
-    graphSize = 0;
-}
-// -------------------------------------------------------------------------------------------
+    void revisit(int, int) {}
 
-// -----------------------------------[Destructor]--------------------------------------------
-// Description: The GraphL destructor is used to dellocate all of the memory
-// that as allocated by the GraphL class. This method iterates through all of
-// the nodes in the graph and deletes all of the nodes and their edges in the graph.
-// -------------------------------------------------------------------------------------------
-GraphL::~GraphL()
+    void finish(int node, int)
+    {
+        finishTime[node] = ++clock;
+    }
+};
+
+// The TopologicalVisitor struct is the visitor for topologicalOrder, it adds each node to the
+// ordering when it is popped and notes a cycle when an edge leads to a node that is still on
+// the stack, which is a node that has been visited but not finished
+struct TopologicalVisitor
 {
-    // For loop to iterate through all of the nodes in the graph
-    for (int nodeIndex = 1; nodeIndex <= graphSize; nodeIndex++)
+    vector<int>& ordering;
+    vector<char>& finished;
+    bool cycle;
+
+    void discover(int) {}
+
+    void revisit(int, int adjacentNode)
     {
-        // The current node is set to the head of the adjacency list
-        // of the node 
-        EdgeNode* currentNode = graphNodes[nodeIndex].edgeHead;
+        cycle = cycle || finished[adjacentNode] == 0;
+    }
 
-        // Node of the data is deleted
-        delete graphNodes[nodeIndex].data;
-        
-        // The node's data is set to nullptr
-        graphNodes[nodeIndex].data = nullptr;
+    void finish(int node, int)
+    {
+        finished[node] = 1;
+        ordering.push_back(node);
+    }
+};
 
-        // The head node of that node's adjacency list is set to nullptr
-        graphNodes[nodeIndex].edgeHead = nullptr;
+// The TarjanVisitor struct is the visitor for stronglyConnectedComponents, it keeps the
+// discovery number and low link of each node and the stack of nodes whose component has not
+// been found yet, a node is on that stack while its component is still 0
+struct TarjanVisitor
+{
+    vector<int>& component;
+    vector<int>& number;
+    vector<int>& lowLink;
+    vector<int>& componentStack;
+    int nodeCount;
+    int componentCount;
 
-        // The node is marked as unvisited
-        graphNodes[nodeIndex].visited = false;
+    // A visited node gets the next number and goes on the component stack
+    void discover(int node)
+    {
+        number[node] = lowLink[node] = ++nodeCount;
+        componentStack.push_back(node);
+    }
 
-        // Iterate through the adjacency list for the current node
-        // and delete all of its edges
-        while (currentNode != nullptr) 
+    // An edge to a node on the component stack is a way back up to that node
+    void revisit(int node, int adjacentNode)
+    {
+        if (component[adjacentNode] == 0 && number[adjacentNode] < lowLink[node])
+        {
+            lowLink[node] = number[adjacentNode];
+        }
+    }
+
+    // A node that can not reach above itself starts a component made of the nodes above it on
+    // the component stack, otherwise its low link is passed on to its parent
+    void finish(int node, int parentNode)
+    {
+        if (lowLink[node] == number[node])
+        {
+            componentCount++;
+            int member;
+
+            do
+            {
+                member = componentStack.back();
+                componentStack.pop_back();
+                component[member] = componentCount;
+            } while (member != node);
+        }
+
+        if (parentNode != 0 && lowLink[node] < lowLink[parentNode])
         {
-            // Temporary edge node used to store the current edge node, then
-            // move the current edge node to the next edge node
-            EdgeNode* temporaryNode = currentNode;
-            currentNode = currentNode->nextEdge;
-            
-            // Delete the temporary edge node and set it to nullptr
-            delete temporaryNode;
-            temporaryNode = nullptr;
+            lowLink[parentNode] = lowLink[node];
         }
     }
+};
+
+// ----------------------------------[Constructor]--------------------------------------------
+// Description: The GraphL constructor initializes an empty graph with no nodes,
+// the array of graph nodes is sized by buildGraph once the number of nodes is known.
+// -------------------------------------------------------------------------------------------
+GraphL::GraphL() 
+{
+    // The graph's size is initialized to 0
+    graphSize = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[Destructor]--------------------------------------------
+// Description: The GraphL destructor is used to dellocate all of the memory
+// that as allocated by the GraphL class. The data of the nodes is released with
+// the arena that it was created in and the edges are released with the CSR graph,
+// so neither has to be deleted one node at a time.
+// -------------------------------------------------------------------------------------------
+GraphL::~GraphL()
+{
 }
 // -------------------------------------------------------------------------------------------
 
@@ -102,25 +168,36 @@ GraphL::~GraphL()
 // Description: The buildGraph method for the GraphL class reads in the input
 // data text file and builds the graph using adjacency lists. The method
 // reads in the size of the graph from the input file and then the data for each
-// node in the graph and creates a new NodeData object for each node that is read in,
-// then the method reads in the data for the edges in the graph.
+// node in the graph, then the method reads in the data for the edges in the graph
+// and stores the graph with the GraphText version of buildGraph.
 // -------------------------------------------------------------------------------------------
 void GraphL::buildGraph(ifstream& inputfile) 
 {
-    // Initialize the variables for the source node, destination node, and data of the node
+    GRAPH_STATS_TIMER(readTimer, statistics.buildSeconds);
+
+    // Initialize the variables for the graph read in, source node, and destination node
+    GraphText graph;
     int sourceNode;
     int destinationNode;
-    string nodeData;
+    string restOfLine;
 
     // Reads in the size of the graph from the input file
-    inputfile >> graphSize;
-    getline(inputfile, nodeData);
+    graph.nodeCount = 0;
+    inputfile >> graph.nodeCount;
+    getline(inputfile, restOfLine);
 
-    // Reads in the data for each node and creates a new NodeData object for the node
-    for (int i = 1; i <= graphSize; i++) 
+    // A negative size is treated the same as an empty graph
+    if (graph.nodeCount < 0)
     {
-        getline(inputfile, nodeData);
-        graphNodes[i].data = new NodeData(nodeData);
+        graph.nodeCount = 0;
+    }
+
+    // Reads in the data for each node
+    graph.descriptions.resize(graph.nodeCount);
+
+    for (int i = 0; i < graph.nodeCount; i++) 
+    {
+        getline(inputfile, graph.descriptions[i]);
     }
 
     // Reads in the data for the edges between the nodes
@@ -132,32 +209,146 @@ void GraphL::buildGraph(ifstream& inputfile)
             break;
         }
 
-        // If the source and destination node are not read in as 0, continue
-        if (sourceNode != 0 && destinationNode != 0)
+        // Edges to or from nodes outside of the bounds of the graph are skipped
+        if (sourceNode < 1 || sourceNode > graph.nodeCount || destinationNode < 1 || destinationNode > graph.nodeCount)
         {
-            // A new edge node is initialized
-            EdgeNode* newNode = new EdgeNode;
+            continue;
+        }
 
-            // Sets the destination node for the new edge node
-            newNode->adjGraphNode = destinationNode;
+        // The new edge is added to the list of edges read in, the weight is not used
+        graph.edges.push_back({sourceNode, destinationNode, 0});
+    }
 
-            // If the source node has an adjacency list
-            if (graphNodes[sourceNode].edgeHead != nullptr)
-            {
-                // The new edge node is added to the beginning of the adjacency
-                // list
-                newNode->nextEdge = graphNodes[sourceNode].edgeHead;
-                graphNodes[sourceNode].edgeHead = newNode;
-            }
-            // If the source node does not have an adjacency list, the new edge node
-            // will be set as the head of the adjacency list for the source node
-            else if (graphNodes[sourceNode].edgeHead == nullptr)
-            {
-                graphNodes[sourceNode].edgeHead = newNode;
-                newNode->nextEdge = nullptr;
-            }
-        }
+    // The GraphText version times the rest of the build itself
+    GRAPH_STATS_STOP(readTimer);
+    buildGraph(graph);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[buildGraph]--------------------------------------------
+// Description: The GraphLoader version of the buildGraph method reads in the next graph
+// from the loader, which follows the same rules as the ifstream version, and stores it.
+// -------------------------------------------------------------------------------------------
+void GraphL::buildGraph(GraphLoader& loader)
+{
+    GRAPH_STATS_TIMER(readTimer, statistics.buildSeconds);
+    GraphText graph;
+    loader.readGraph(graph, false);
+    GRAPH_STATS_STOP(readTimer);
+    buildGraph(graph);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[buildGraph]--------------------------------------------
+// Description: The GraphText version of the buildGraph method, used by the other two
+// versions once they have read in the graph, creates a new NodeData object in the arena
+// for each node that was read in and stores the edges in a CSR graph, each new edge goes
+// at the beginning of its node's adjacency list.
+// -------------------------------------------------------------------------------------------
+void GraphL::buildGraph(const GraphText& graph)
+{
+    GRAPH_STATS_TIMER(buildTimer, statistics.buildSeconds);
+    graphSize = graph.nodeCount;
+
+    // The data of a graph that was built before is released
+    nodeDataArena.clear();
+
+    // The array of graph nodes is sized from the number of nodes, subscript 0 is unused,
+    // every node starts with no data and as unvisited
+    GraphNode emptyNode;
+    emptyNode.data = nullptr;
+    emptyNode.visited = false;
+    graphNodes.assign(graphSize + 1, emptyNode);
+
+    // Room for the data of every node is allocated from the arena at once
+    nodeDataArena.reserve(graphSize);
+
+    // Creates a new NodeData object in the arena for each node
+    for (int i = 1; i <= graphSize; i++) 
+    {
+        graphNodes[i].data = nodeDataArena.create(graph.descriptions[i - 1]);
     }
+
+    // Each new edge is added to the beginning of its node's adjacency list, so the edges are
+    // stored in the CSR graph in the reverse of the order they were read in, edges that are
+    // read in more than once are all kept
+    vector<CsrEdge> reversedEdgeList(graph.edges.rbegin(), graph.edges.rend());
+    adjacency.build(graphSize, reversedEdgeList, true);
+
+    // The depth-first search stack is sized once here, a path can hold every node at most once
+    searchStack.resize(graphSize);
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[saveSnapshot]-------------------------------------------
+// Description: The saveSnapshot method for the GraphL class writes the node descriptions and
+// the adjacency lists to a snapshot file. It returns false if the file could not be written.
+// -------------------------------------------------------------------------------------------
+bool GraphL::saveSnapshot(const string& fileName) const
+{
+    SnapshotContents contents;
+    contents.graphKind = GraphSnapshot::UNWEIGHTED_GRAPH;
+    contents.edges = &adjacency;
+    contents.reverseEdges = nullptr;
+
+    for (int nodeIndex = 1; nodeIndex <= graphSize; nodeIndex++)
+    {
+        contents.descriptions.push_back(graphNodes[nodeIndex].data->getData());
+    }
+
+    return GraphSnapshot::write(fileName, contents);
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[loadSnapshot]-------------------------------------------
+// Description: The loadSnapshot method for the GraphL class replaces the graph with the one
+// in a snapshot file written by saveSnapshot. The file is memory mapped and the adjacency
+// lists are a view of its edge arrays, which are already in adjacency list order. It returns
+// false, and leaves the graph unchanged, if the file cannot be used.
+// -------------------------------------------------------------------------------------------
+bool GraphL::loadSnapshot(const string& fileName)
+{
+    GRAPH_STATS_TIMER(buildTimer, statistics.buildSeconds);
+    shared_ptr<GraphSnapshot> snapshot = make_shared<GraphSnapshot>();
+
+    if (!snapshot->open(fileName) || snapshot->graphKind() != GraphSnapshot::UNWEIGHTED_GRAPH)
+    {
+        return false;
+    }
+
+    graphSize = snapshot->nodeCount();
+
+    // The data of a graph that was built before is released and the nodes are created again
+    nodeDataArena.clear();
+
+    GraphNode emptyNode;
+    emptyNode.data = nullptr;
+    emptyNode.visited = false;
+    graphNodes.assign(graphSize + 1, emptyNode);
+    nodeDataArena.reserve(graphSize);
+
+    for (int i = 1; i <= graphSize; i++)
+    {
+        graphNodes[i].data = nodeDataArena.create(snapshot->description(i));
+    }
+
+    // The CSR graph uses the edge arrays of the mapped file, the snapshot is kept open by it
+    adjacency.view(graphSize, snapshot->edgeCount(), snapshot->edgeOffsets(), snapshot->edgeTargets(),
+                   snapshot->edgeWeights(), snapshot);
+
+    searchStack.resize(graphSize);
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[displayGraph]-------------------------------------------
+// Description: The stream version of the displayGraph method collects the text in an output
+// buffer and writes it to the stream when it is done, the stream is not flushed.
+// -------------------------------------------------------------------------------------------
+void GraphL::displayGraph(ostream& output)
+{
+    OutputBuffer buffer(output);
+    displayGraph(buffer);
 }
 // -------------------------------------------------------------------------------------------
 
@@ -166,92 +357,285 @@ void GraphL::buildGraph(ifstream& inputfile)
 // information. It iterates through every node in the graph and prints its index
 // out and every edge that is adjacent to that node.
 // -------------------------------------------------------------------------------------------
-void GraphL::displayGraph()
+void GraphL::displayGraph(OutputBuffer& output)
 {
-    cout << "Graph:" << endl;
+    GRAPH_STATS_TIMER(displayTimer, statistics.displaySeconds);
+    output << "Graph:" << '\n';
 
     // For loop used to iterate through all the nodes in the graph
     for (int nodeIndex = 1; nodeIndex <= graphSize; nodeIndex++)
     {   
         // Node and its number are printed followed by the data of the node
-        cout << "Node" << nodeIndex << "      " << *(graphNodes[nodeIndex].data) << endl << endl;
+        output << "Node" << nodeIndex << "      " << graphNodes[nodeIndex].data->getData() << '\n' << '\n';
     
         // For loop used to iterate through all of the edges of the current node
-        for(EdgeNode* currentNode = graphNodes[nodeIndex].edgeHead; currentNode != nullptr; currentNode = currentNode->nextEdge)
+        for (int edge = adjacency.beginEdge(nodeIndex); edge < adjacency.endEdge(nodeIndex); edge++)
         {
             // Each edge adjacent to the current node is printed out
-            cout << "  " << "edge" << "  " << nodeIndex << "  " << currentNode->adjGraphNode << endl;
+            output << "  " << "edge" << "  " << nodeIndex << "  " << adjacency.edgeTarget(edge) << '\n';
         }
     }
 }
 // -------------------------------------------------------------------------------------------
 
+// --------------------------------[depthFirstSearch]-----------------------------------------
+// Description: The stream version of the depthFirstSearch method collects the ordering in an
+// output buffer and writes it to the stream when it is done, the stream is not flushed.
+// -------------------------------------------------------------------------------------------
+void GraphL::depthFirstSearch(ostream& output)
+{
+    OutputBuffer buffer(output);
+    depthFirstSearch(buffer);
+}
+// -------------------------------------------------------------------------------------------
+
 // --------------------------------[depthFirstSearch]-----------------------------------------
 // Description: The depthFirstSearch method in the GraphL class is used to implement
-// the depth-first search graph traversal algorithm by using a helper method.
-// This method iterates through all of the nodes in the graph and checks to see
-// if the current node has been visited or not and calls the helper method when
-// it has found a node that has not been visited.
+// the depth-first search graph traversal algorithm. It gets the depth-first ordering
+// of the nodes from the depthFirstOrdering method and prints it out.
 // -------------------------------------------------------------------------------------------
-void GraphL::depthFirstSearch()
+void GraphL::depthFirstSearch(OutputBuffer& output)
 {
-    cout << "Depth-first ordering:";
-    
+    vector<int> ordering;
+    depthFirstOrdering(ordering);
+
+    // Only the printing counts as display time, depthFirstOrdering times the search itself
+    GRAPH_STATS_TIMER(displayTimer, statistics.displaySeconds);
+    output << "Depth-first ordering:";
+
+    // Print every node in the order it was visited
+    for (int node : ordering)
+    {
+        output << "  " << node;
+    }
+
+    output << '\n';
+    output << '\n';
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[depthFirstOrdering]----------------------------------------
+// Description: The depthFirstOrdering method in the GraphL class fills ordering with
+// the depth-first ordering of the nodes. Every node is first marked as unvisited, then
+// the method iterates through all of the nodes in the graph and calls the helper
+// method when it has found a node that has not been visited. The ordering vector is
+// cleared first, so a caller that reuses it does not allocate memory again.
+// -------------------------------------------------------------------------------------------
+void GraphL::depthFirstOrdering(vector<int>& ordering)
+{
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    ordering.clear();
+    ordering.reserve(graphSize);
+
+    // Every node is marked as unvisited so the search can be run more than once
+    markUnvisited();
+
     // Iterate through all of the nodes in the graph
-    for (int currentNode = 1; currentNode <= graphSize; currentNode++) 
+    for (int currentNode = 1; currentNode <= graphSize; currentNode++)
     {
-        // Continue to the next node if the current node has been visited
-        if (graphNodes[currentNode].visited == true)
+        // If the current node has not been visited, perform a depth-first search
+        // on this node by calling the helper method
+        if (graphNodes[currentNode].visited == false)
         {
-            continue;
+            depthFirstSearchHelper(currentNode, ordering);
         }
+    }
+}
+// -------------------------------------------------------------------------------------------
 
-        // If the current node has not been visited, perform a depth-first search
-        // on this node by calling the helper method
+// -----------------------------[depthFirstSearchHelper]--------------------------------------
+// Description: The depthFirstSearchHelper method in the GraphL class is the helper method
+// for the depthFirstOrdering method, it runs depthFirstTraversal from the source node and
+// adds each node to the ordering when it is visited.
+// -------------------------------------------------------------------------------------------
+void GraphL::depthFirstSearchHelper(int sourceNode, vector<int>& ordering)
+{
+    OrderingVisitor visitor{ordering};
+    depthFirstTraversal(sourceNode, visitor);
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[depthFirstTimes]------------------------------------------
+// Description: The depthFirstTimes method in the GraphL class runs the same search as
+// depthFirstOrdering and fills discovery and finish with the time each node was visited and
+// the time it was popped off the stack, a single clock counts both kinds of steps. A node's
+// descendants in the search are the nodes whose times lie between its two times.
+// -------------------------------------------------------------------------------------------
+void GraphL::depthFirstTimes(vector<int>& discovery, vector<int>& finish)
+{
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    discovery.assign(graphSize + 1, 0);
+    finish.assign(graphSize + 1, 0);
+    markUnvisited();
+
+    TimeVisitor visitor{discovery, finish, 0};
+
+    for (int currentNode = 1; currentNode <= graphSize; currentNode++)
+    {
+        if (graphNodes[currentNode].visited == false)
+        {
+            depthFirstTraversal(currentNode, visitor);
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[topologicalOrder]------------------------------------------
+// Description: The topologicalOrder method in the GraphL class puts the nodes in the reverse
+// of the order they finish in the depth-first search, which puts every node before the nodes
+// its edges lead to. The graph has a cycle exactly when the search follows an edge back to a
+// node that is still on the stack, then false is returned and the ordering is left empty.
+// -------------------------------------------------------------------------------------------
+bool GraphL::topologicalOrder(vector<int>& ordering)
+{
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    ordering.clear();
+    ordering.reserve(graphSize);
+    markUnvisited();
+
+    vector<char> finished(graphSize + 1, 0);
+    TopologicalVisitor visitor{ordering, finished, false};
+
+    for (int currentNode = 1; currentNode <= graphSize && !visitor.cycle; currentNode++)
+    {
         if (graphNodes[currentNode].visited == false)
         {
-            depthFirstSearchHelper(currentNode);
+            depthFirstTraversal(currentNode, visitor);
         }
     }
 
-    cout << endl;
-    cout << endl;
+    if (visitor.cycle)
+    {
+        ordering.clear();
+        return false;
+    }
+
+    reverse(ordering.begin(), ordering.end());
+    return true;
 }
 // -------------------------------------------------------------------------------------------
 
-// -----------------------------[depthFirstSearchHelper]--------------------------------------
-// Description: The depthFirstSearchHelper method in the GraphL class is a 
-// recursive helper method for the depthFirstSearch method for performing a 
-// depth-first traversal on a graph. It marks the source node as visited and 
-// prints its index, then it traverses the adjacency list of the source node
-// and checks if each adjacent node has been visited, if a node hasn't been visited,
-// it recursively calls itself with the adjacent node as the new source node.
-// The depth-first ordering of the nodes are returned.
-// -------------------------------------------------------------------------------------------
-void GraphL::depthFirstSearchHelper(int sourceNode)
+// ---------------------------[stronglyConnectedComponents]-----------------------------------
+// Description: The stronglyConnectedComponents method in the GraphL class finds the strongly
+// connected components with Tarjan's algorithm. Each node gets its discovery number and the
+// smallest discovery number it can reach through the nodes on the component stack (its low
+// link), and a node whose low link is its own number is the first node of a component, which
+// is every node above it on the component stack. The components are numbered in the order
+// they are found, so an edge between two components always goes from a higher number to a
+// lower one.
+// -------------------------------------------------------------------------------------------
+int GraphL::stronglyConnectedComponents(vector<int>& component)
 {
-    // Current node is set to the first node in the adjacency list
-    // of the source node
-    EdgeNode* currentNode = graphNodes[sourceNode].edgeHead; 
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    component.assign(graphSize + 1, 0);
+    markUnvisited();
 
-    graphNodes[sourceNode].visited = true; 
+    vector<int> number(graphSize + 1, 0);
+    vector<int> lowLink(graphSize + 1, 0);
+    vector<int> componentStack;
+    componentStack.reserve(graphSize);
+    TarjanVisitor visitor{component, number, lowLink, componentStack, 0, 0};
 
-    cout << "  " << sourceNode;
+    for (int currentNode = 1; currentNode <= graphSize; currentNode++)
+    {
+        if (graphNodes[currentNode].visited == false)
+        {
+            depthFirstTraversal(currentNode, visitor);
+        }
+    }
+    return visitor.componentCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------[weaklyConnectedComponents]------------------------------------
+// Description: The weaklyConnectedComponents method in the GraphL class finds the components
+// of the graph with the directions of the edges ignored. Every edge joins the sets of its two
+// nodes in a union-find, which keeps the root of each set and halves the paths to it on the
+// way, so there is no need for a copy of the graph with the edges reversed. The components
+// are numbered in the order of their smallest node.
+// -------------------------------------------------------------------------------------------
+int GraphL::weaklyConnectedComponents(vector<int>& component)
+{
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+
+    // Every node starts in a set of its own, parent holds the parent of each node in its set
+    vector<int> parent(graphSize + 1);
+
+    for (int node = 0; node <= graphSize; node++)
+    {
+        parent[node] = node;
+    }
 
-    while (currentNode != nullptr) 
-    { 
-        // If the node adjacent to the current node has been visited, traverse to the next node
-        // in the adjacency list
-        if (graphNodes[currentNode->adjGraphNode].visited == true)
+    // Finds the root of the set of a node, pointing every other node on the way at its grandparent
+    auto findRoot = [&parent](int node)
+    {
+        while (parent[node] != node)
         {
-            currentNode = currentNode->nextEdge;
+            parent[node] = parent[parent[node]];
+            node = parent[node];
         }
-        // If the node adjacent to the current node has not been visited, recursively call
-        // the method with the source node updated to the adjacent node
-        else if (graphNodes[currentNode->adjGraphNode].visited == false)
+        return node;
+    };
+
+    // The sets of the two nodes of each edge are joined, the smaller root becomes the root
+    for (int node = 1; node <= graphSize; node++)
+    {
+        for (int edge = adjacency.beginEdge(node); edge < adjacency.endEdge(node); edge++)
         {
-            depthFirstSearchHelper(currentNode->adjGraphNode);
+            int firstRoot = findRoot(node);
+            int secondRoot = findRoot(adjacency.edgeTarget(edge));
+
+            if (firstRoot != secondRoot)
+            {
+                parent[max(firstRoot, secondRoot)] = min(firstRoot, secondRoot);
+            }
         }
     }
+
+    // The root of each set is its smallest node, so it is numbered before the rest of its set
+    component.assign(graphSize + 1, 0);
+    int componentCount = 0;
+
+    for (int node = 1; node <= graphSize; node++)
+    {
+        int root = findRoot(node);
+        component[node] = root == node ? ++componentCount : component[root];
+    }
+    return componentCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[markUnvisited]-------------------------------------------
+// Description: The markUnvisited method in the GraphL class marks every node as unvisited,
+// so that a search can be run more than once.
+// -------------------------------------------------------------------------------------------
+void GraphL::markUnvisited()
+{
+    for (int currentNode = 1; currentNode <= graphSize; currentNode++)
+    {
+        graphNodes[currentNode].visited = false;
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[getStats]----------------------------------------------
+// Description: The getStats method for the GraphL class returns the counters of the
+// depth-first search and the timings of the build, compute and display phases kept since
+// the graph was created or resetStats was last called. They are only kept when the program
+// is compiled with GRAPH_STATS defined, otherwise every field is 0.
+// -------------------------------------------------------------------------------------------
+const GraphStats& GraphL::getStats() const
+{
+    return statistics;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[resetStats]---------------------------------------------
+// Description: The resetStats method for the GraphL class sets the counters and timings back
+// to 0, so that the stats read after the next search only hold the work of that search.
+// -------------------------------------------------------------------------------------------
+void GraphL::resetStats()
+{
+    statistics.reset();
 }
 // -------------------------------------------------------------------------------------------
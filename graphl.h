@@ -2,35 +2,46 @@
 // David Schurer
 // CSS 343
 // Creation Date: 4/27/2023
-// Date of Last Modification: 5/5/2023
+// Date of Last Modification: 10/17/2026
 // ---------------------------------------------------------------------
 // Purpose - The graphl.h file is the header file for the GraphL class
 // which represents a graph data structure and is used for the depth-first
 // search traversal of a graph. It contains the method declarations
-// for the GraphL class and a global constant integer variable
-// to represent the maximum number of nodes that can be stored in
-// the graph.
+// for the GraphL class and the struct used for the nodes of the graph.
 // ---------------------------------------------------------------------
-// Notes - This method contains a struct EdgeNode to represent an 
-// edge in the graph and it contains the nextEdge pointer, which points
-// to the next edge in the adjacency list as well as the adjGraphNode
-// data member to represent the subscript of the adjacent graph node.
-// Additionally, this method contains a struct GraphNode to represent
-// each node and has an EdgeNode pointer edgeHead which points to the first
-// node in the edge and data memebers for the data of the node and
-// the visited status of the node.
+// Notes - The adjacency lists of the graph are stored in a compressed
+// sparse row (CSR) graph, the edges of each node are kept next to each
+// other in the order the adjacency list of that node would have, with
+// the most recently read in edge first. The NodeData of the nodes is
+// created in an arena owned by the graph and freed with it. This header
+// also contains a struct GraphNode to represent each node with data
+// members for the data of the node and the visited status of the node.
+// The depth-first search uses an explicit stack instead of recursion so
+// that long chains of nodes can not overflow the call stack. The same
+// search also gives the discovery and finish times of the nodes, a
+// topological order with cycle detection and the strongly connected
+// components (Tarjan's algorithm), each in linear time and returned in
+// arrays indexed by node number. The weakly connected components are
+// found with a union-find over the edges. When the program is compiled
+// with GRAPH_STATS defined, the graph counts the edges the search
+// follows and the deepest its stack gets, and times the build, search
+// and display phases, see graphstats.h.
 // ---------------------------------------------------------------------
 #ifndef GRAPH_L
 #define GRAPH_L
 #include "nodedata.h"
+#include "csrgraph.h"
+#include "objectarena.h"
+#include "graphloader.h"
+#include "graphsnapshot.h"
+#include "outputbuffer.h"
+#include "graphstats.h"
 #include <iostream>
 #include <fstream>
 #include <climits>
+#include <vector>
 using namespace std;
 
-// Global constant int variable to represent the max number of nodes in the graph
-const int GRAPHL_MAXNODES = 100;
-
 class GraphL {
 
     public:
@@ -41,40 +52,153 @@ class GraphL {
         // Methods for constructing the graph and
         // displaying the contents of the graph
         void buildGraph(ifstream &inputfile);
-        void displayGraph();
+        void displayGraph(ostream& output = cout);
+        void displayGraph(OutputBuffer& output);
+
+        // Version of buildGraph that builds the graph from a graph that has already been read in
+        void buildGraph(const GraphText& graph);
+
+        // Version of buildGraph that reads the next graph from a GraphLoader, which is much
+        // faster for large input files
+        void buildGraph(GraphLoader& loader);
+
+        // Methods for writing the graph to a binary snapshot file and loading it back,
+        // both return false if the file cannot be used
+        bool saveSnapshot(const string& fileName) const;
+        bool loadSnapshot(const string& fileName);
 
         // Method for implementing the depth-first search
-        // traversal on the graph
-        void depthFirstSearch();
+        // traversal on the graph, the ordering is printed to cout unless another stream or
+        // an output buffer is given
+        void depthFirstSearch(ostream& output = cout);
+        void depthFirstSearch(OutputBuffer& output);
 
-    private:
-        // The EdgeNode struct represents the edge between nodes in the graph
-        struct EdgeNode;
+        // Method that fills ordering with the depth-first ordering of the nodes
+        // instead of printing it
+        void depthFirstOrdering(vector<int>& ordering);
+
+        // depthFirstTimes fills discovery and finish with the time each node was first reached and
+        // the time all of its edges had been followed in the search of depthFirstOrdering, the times
+        // go from 1 to 2 * the number of nodes
+        void depthFirstTimes(vector<int>& discovery, vector<int>& finish);
+
+        // topologicalOrder fills ordering with the nodes so that every edge goes from a node to a
+        // later node and returns true, or returns false with an empty ordering if there is a cycle
+        bool topologicalOrder(vector<int>& ordering);
+
+        // stronglyConnectedComponents and weaklyConnectedComponents fill component with the number
+        // of the component of each node, from 1 to the number of components, which is returned
+        int stronglyConnectedComponents(vector<int>& component);
+        int weaklyConnectedComponents(vector<int>& component);
 
+        // getStats returns the counters and timings kept since the graph was created or resetStats
+        // was last called, they stay at 0 unless the program is compiled with GRAPH_STATS defined
+        const GraphStats& getStats() const;
+        void resetStats();
+
+    private:
         // The GraphNode struct represents each node in the graph
         struct GraphNode 
         {
-            EdgeNode* edgeHead;
             NodeData* data;
             bool visited;
         };
 
-        // The EdgeNode struct represents the edge between nodes in the graph
-        struct EdgeNode 
+        // Integer variable representing the size of the graph
+        int graphSize;
+
+        // Array of GraphNode structs to represent the nodes in the graph (subscripts 1 to graphSize),
+        // sized from the number of nodes read in by buildGraph
+        vector<GraphNode> graphNodes;
+
+        // Adjacency lists of all of the nodes stored as a CSR graph
+        CsrGraph adjacency;
+
+        // Arena that owns the NodeData of every node, the data members of the
+        // graph nodes point into it
+        ObjectArena<NodeData> nodeDataArena;
+
+        // The SearchFrame struct is one entry of the depth-first search stack, it holds
+        // a node and the next of its edges to be followed
+        struct SearchFrame
         {
-            int adjGraphNode;
-            EdgeNode* nextEdge;
+            int node;
+            int nextEdge;
         };
 
-        // Integer variable representing the size of the graph
-        int graphSize;
+        // Stack of the depth-first search, sized by buildGraph so that no memory is
+        // allocated during the search, it never holds more than graphSize frames
+        vector<SearchFrame> searchStack;
+
+        // Counters of the depth-first search and timings of the phases, see graphstats.h
+        GraphStats statistics;
 
-        // Array of GraphNode structs to represent the nodes in the graph
-        GraphNode graphNodes[GRAPHL_MAXNODES];
+        // Iterative helper method for the depth-first search method
+        void depthFirstSearchHelper(int source, vector<int>& ordering);
 
-        // Recursive helper method for the depth-first search method
-        void depthFirstSearchHelper(int source);
+        // Helper method that marks every node as unvisited before a search
+        void markUnvisited();
+
+        // Helper method for all of the searches, a depth-first search from the source node over
+        // the unvisited nodes that calls visitor.discover(node) when a node is first reached,
+        // visitor.revisit(node, adjacentNode) for an edge to a node that was already reached and
+        // visitor.finish(node, parentNode) once all of the edges of a node have been followed
+        template <typename Visitor>
+        void depthFirstTraversal(int sourceNode, Visitor& visitor);
 
 };
 
+// ------------------------------[depthFirstTraversal]----------------------------------------
+// Description: The depthFirstTraversal method in the GraphL class is the iterative depth-first
+// search used by all of the searches of the class. It marks the source node as visited and
+// pushes it on the stack. The node on top of the stack follows its next edge in the CSR
+// graph, and if the adjacent node hasn't been visited it is visited and pushed the same way,
+// a node is popped once all of its edges have been followed. This visits the nodes in the
+// same order as a recursive search would. The visitor is told about each of these steps, the
+// parent node given to finish is the node below on the stack, or 0 for the source node.
+// -------------------------------------------------------------------------------------------
+template <typename Visitor>
+void GraphL::depthFirstTraversal(int sourceNode, Visitor& visitor)
+{
+    int stackSize = 0;
+
+    graphNodes[sourceNode].visited = true;
+    visitor.discover(sourceNode);
+    searchStack[stackSize++] = {sourceNode, adjacency.beginEdge(sourceNode)};
+    GRAPH_STATS_MAX(statistics, maxStackDepth, stackSize);
+
+    // Continue until every node reachable from the source node has been visited
+    while (stackSize > 0)
+    {
+        SearchFrame& frame = searchStack[stackSize - 1];
+
+        // Pop the node once all of its edges have been followed
+        if (frame.nextEdge == adjacency.endEdge(frame.node))
+        {
+            stackSize--;
+            visitor.finish(frame.node, stackSize > 0 ? searchStack[stackSize - 1].node : 0);
+            continue;
+        }
+
+        // Follow the next edge of the node, they are stored next to each other in the CSR graph
+        int adjacentNode = adjacency.edgeTarget(frame.nextEdge);
+        frame.nextEdge++;
+        GRAPH_STATS_ADD(statistics, searchEdges, 1);
+
+        // If the adjacent node has not been visited, visit it and push it on the stack
+        if (graphNodes[adjacentNode].visited == false)
+        {
+            graphNodes[adjacentNode].visited = true;
+            visitor.discover(adjacentNode);
+            searchStack[stackSize++] = {adjacentNode, adjacency.beginEdge(adjacentNode)};
+            GRAPH_STATS_MAX(statistics, maxStackDepth, stackSize);
+        }
+        else
+        {
+            visitor.revisit(frame.node, adjacentNode);
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
 #endif
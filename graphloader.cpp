@@ -0,0 +1,290 @@
+// --------------------------- graphloader.cpp -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphloader.cpp file is the implementation file for the
+// GraphLoader class. It contains the methods that open and close the
+// input data text file and the method that reads in one graph, along
+// with the helper methods that read an integer and a line.
+// ---------------------------------------------------------------------
+// Notes - readInt and readLine follow the rules of the stream extraction
+// operator and getline: whitespace is skipped before a number, a number
+// that runs up to the end of the file or a line with no newline at the
+// end of the file sets eof, and once a read has failed every later read
+// fails too. This keeps the graphs read in, and the point where eof is
+// set, the same as with the ifstream version of buildGraph.
+// ---------------------------------------------------------------------
+#include "graphloader.h"
+#include <vector>
+#include <string>
+#include <cstring>
+#include <charconv>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+using namespace std;
+
+// Size of the blocks the file is read in when it can not be memory mapped
+const size_t READ_BLOCK_SIZE = 1 << 20;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The GraphLoader constructor creates a loader with no file open, reading
+// from it reaches the end of the file right away.
+// -------------------------------------------------------------------------------------------
+GraphLoader::GraphLoader()
+{
+    mapping = nullptr;
+    mappingLength = 0;
+    close();
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Destructor]----------------------------------------------
+// Description: The GraphLoader destructor releases the file.
+// -------------------------------------------------------------------------------------------
+GraphLoader::~GraphLoader()
+{
+    close();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[open]------------------------------------------------
+// Description: The open method memory maps the file, if it can not be mapped (a pipe or an
+// empty file) its contents are read in large blocks instead. It returns false if the file
+// could not be opened.
+// -------------------------------------------------------------------------------------------
+bool GraphLoader::open(const string& fileName)
+{
+    close();
+
+    int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    // A regular file is mapped in one piece and read from front to back
+    struct stat fileStatus;
+
+    if (fstat(fileDescriptor, &fileStatus) == 0 && S_ISREG(fileStatus.st_mode) && fileStatus.st_size > 0)
+    {
+        void* address = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (address != MAP_FAILED)
+        {
+            madvise(address, fileStatus.st_size, MADV_SEQUENTIAL);
+            mapping = address;
+            mappingLength = fileStatus.st_size;
+            begin = static_cast<const char*>(address);
+            end = begin + mappingLength;
+        }
+    }
+
+    // Otherwise the file is read in blocks until the end of the file
+    if (mapping == nullptr)
+    {
+        size_t length = 0;
+        ssize_t bytesRead;
+
+        do
+        {
+            buffer.resize(length + READ_BLOCK_SIZE);
+            bytesRead = read(fileDescriptor, buffer.data() + length, READ_BLOCK_SIZE);
+
+            if (bytesRead > 0)
+            {
+                length += bytesRead;
+            }
+        } while (bytesRead > 0);
+
+        buffer.resize(length);
+        begin = buffer.data();
+        end = begin + length;
+    }
+
+    ::close(fileDescriptor);
+    cursor = begin;
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[close]-----------------------------------------------
+// Description: The close method unmaps the file or frees its contents, the loader is left
+// with nothing to read.
+// -------------------------------------------------------------------------------------------
+void GraphLoader::close()
+{
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappingLength);
+    }
+
+    mapping = nullptr;
+    mappingLength = 0;
+    buffer.clear();
+    buffer.shrink_to_fit();
+    begin = nullptr;
+    end = nullptr;
+    cursor = nullptr;
+    atEnd = false;
+    failed = false;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[readGraph]--------------------------------------------
+// Description: The readGraph method reads in the number of nodes, the description of each
+// node and the edges of the next graph up to the edge with a 0 node. A weighted graph with
+// no nodes has nothing else read in, like GraphM, an unweighted graph always reads the rest
+// of its first line and its edges, like GraphL. A negative number of nodes is read as 0.
+// -------------------------------------------------------------------------------------------
+void GraphLoader::readGraph(GraphText& graph, bool weighted)
+{
+    int fromNode;
+    int toNode;
+    int weight = 0;
+    string restOfLine;
+
+    graph.nodeCount = 0;
+    graph.descriptions.clear();
+    graph.edges.clear();
+
+    readInt(graph.nodeCount);
+
+    if (graph.nodeCount < 0)
+    {
+        graph.nodeCount = 0;
+    }
+
+    if (weighted && graph.nodeCount == 0)
+    {
+        return;
+    }
+
+    // The rest of the line with the number of nodes is skipped, then one line is read for each node
+    readLine(restOfLine);
+    graph.descriptions.resize(graph.nodeCount);
+
+    for (int i = 0; i < graph.nodeCount; i++)
+    {
+        readLine(graph.descriptions[i]);
+    }
+
+    // The edges are read until an edge with a 0 node or until a read fails
+    while (true)
+    {
+        bool edgeRead = readInt(fromNode) && readInt(toNode) && (!weighted || readInt(weight));
+
+        if (!edgeRead || fromNode == 0 || toNode == 0)
+        {
+            break;
+        }
+
+        if (fromNode >= 1 && fromNode <= graph.nodeCount && toNode >= 1 && toNode <= graph.nodeCount)
+        {
+            graph.edges.push_back({fromNode, toNode, weight});
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------------[eof]------------------------------------------------
+// Description: The eof method returns true once a read has reached the end of the file.
+// -------------------------------------------------------------------------------------------
+bool GraphLoader::eof() const
+{
+    return atEnd;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[readInt]----------------------------------------------
+// Description: The readInt method skips whitespace and reads a number with an optional sign,
+// it returns false if there is no number left to read. A token that is not a number, or
+// a number too large for an int, ends the input.
+// -------------------------------------------------------------------------------------------
+bool GraphLoader::readInt(int& value)
+{
+    if (failed)
+    {
+        return false;
+    }
+
+    // Whitespace before the number is skipped
+    while (cursor < end && (*cursor == ' ' || (*cursor >= '\t' && *cursor <= '\r')))
+    {
+        cursor++;
+    }
+
+    if (cursor == end)
+    {
+        atEnd = true;
+        failed = true;
+        return false;
+    }
+
+    // from_chars does not accept a plus sign, so it is skipped here
+    const char* numberStart = cursor;
+
+    if (*numberStart == '+' && numberStart + 1 < end && *(numberStart + 1) != '-')
+    {
+        numberStart++;
+    }
+
+    from_chars_result result = from_chars(numberStart, end, value);
+
+    if (result.ec != errc())
+    {
+        atEnd = true;
+        failed = true;
+        return false;
+    }
+
+    cursor = result.ptr;
+
+    // Like a stream, reading a number that runs up to the end of the file sets eof
+    if (cursor == end)
+    {
+        atEnd = true;
+    }
+
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[readLine]---------------------------------------------
+// Description: The readLine method reads the characters up to the next newline into line
+// and skips the newline, it returns false if there is nothing left to read. A last line
+// with no newline at the end of the file is read and sets eof.
+// -------------------------------------------------------------------------------------------
+bool GraphLoader::readLine(string& line)
+{
+    if (failed)
+    {
+        return false;
+    }
+
+    if (cursor == end)
+    {
+        atEnd = true;
+        failed = true;
+        return false;
+    }
+
+    const char* newline = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+
+    if (newline == nullptr)
+    {
+        line.assign(cursor, end);
+        cursor = end;
+        atEnd = true;
+        return true;
+    }
+
+    line.assign(cursor, newline);
+    cursor = newline + 1;
+    return true;
+}
+// -------------------------------------------------------------------------------------------
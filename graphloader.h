@@ -0,0 +1,83 @@
+// ---------------------------- graphloader.h --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphloader.h file is the header file for the GraphLoader
+// class, which reads the graphs of an input data text file much faster
+// than extracting one token at a time from an ifstream. GraphM and GraphL
+// both have a buildGraph method that takes a GraphLoader, so the same
+// loader can feed either graph class one graph at a time.
+// ---------------------------------------------------------------------
+// Notes - The whole file is memory mapped, or read in large blocks when
+// it can not be mapped, and the integers are parsed with from_chars
+// instead of going through the locale of a stream. The format is the same
+// as the one read by the ifstream version of buildGraph: the number of
+// nodes on a line, one description line for each node, then the edges as
+// "from to weight" triples for GraphM or "from to" pairs for GraphL, until
+// an edge with a 0 node. Edges to or from nodes outside of the graph are
+// skipped. The eof method works like the eof method of a stream, it is
+// true once a read has reached the end of the file. A token that is not
+// a number ends the input, since the graph can not be read past it.
+// ---------------------------------------------------------------------
+#ifndef GRAPH_LOADER_H
+#define GRAPH_LOADER_H
+#include "csrgraph.h"
+#include <vector>
+#include <string>
+using namespace std;
+
+// The GraphText struct holds one graph as it was read in from the input data text file
+struct GraphText
+{
+    int nodeCount;
+    vector<string> descriptions;
+    vector<CsrEdge> edges;
+};
+
+class GraphLoader {
+
+    public:
+        // GraphLoader constructor creates a loader with no file open, the destructor closes the file
+        GraphLoader();
+        ~GraphLoader();
+
+        // The loader owns the mapping of its file so it can not be copied
+        GraphLoader(const GraphLoader&) = delete;
+        GraphLoader& operator=(const GraphLoader&) = delete;
+
+        // open maps or reads in the file and returns false if it could not be opened
+        bool open(const string& fileName);
+
+        // close releases the file, the loader can then open another file
+        void close();
+
+        // readGraph reads in the next graph, weighted graphs have a weight after the nodes of
+        // each edge and are read like GraphM, unweighted graphs are read like GraphL
+        void readGraph(GraphText& graph, bool weighted);
+
+        // eof returns true once a read has reached the end of the file
+        bool eof() const;
+
+    private:
+        // Start and end of the contents of the file, and the position of the next character to read
+        const char* begin;
+        const char* end;
+        const char* cursor;
+
+        // Set once a read has reached the end of the file, and once a read has failed
+        bool atEnd;
+        bool failed;
+
+        // Contents of the file when it is read in blocks, and the mapping when it is memory mapped
+        vector<char> buffer;
+        void* mapping;
+        size_t mappingLength;
+
+        // Helper methods that read one integer or the rest of a line like the stream operators
+        bool readInt(int& value);
+        bool readLine(string& line);
+};
+
+#endif
@@ -2,13 +2,13 @@
 // David Schurer
 // CSS 343
 // Creation Date: 4/27/2023
-// Date of Last Modification: 5/5/2023
+// Date of Last Modification: 10/17/2026
 // ---------------------------------------------------------------------
 // Purpose - The graphm.cpp file is the implementation file for the GraphM
 // class. It contains the implementation of all of the methods defined in this
 // class, such as insertEdge, removeEdge, findShortestPath, display, displayAll,
-// etc. It also utilizes two recursive helper methods: recursivePathHelper
-// and recursiveNodeDataHelper.
+// etc. The paths are extracted from T with the tablePath helper method, which
+// follows the path of each node back from the destination node in a loop.
 // ---------------------------------------------------------------------
 // Notes - This class implements a graph date structure and also implements
 // Dijkstra's shortest path algorithm to find the shortest path between all
@@ -17,9 +17,11 @@
 // source node that are unvisited and chooses the neighbor node with
 // the shortest distance to visit, the distances and paths are then updated
 // for the neighbor nodes that are unvisited and this repeats until all the
-// nodes in the graph have been visited. The graph is represented as an adjacency
-// matrix in this implementation and recursion is used to help display the
-// paths and node data of the graph.
+// nodes in the graph have been visited. The graph is represented as a compressed
+// sparse row (CSR) graph of the existing edges sized from the number of nodes read
+// in, which Dijkstra's algorithm scans while a 4-ary heap picks the next node to visit.
+// An edge weight is added to a distance with WeightTraits, so a sum that does not fit
+// in an int is infinity instead of wrapping around to a short negative distance.
 // ---------------------------------------------------------------------
 #include "graphm.h"
 #include <iostream>
@@ -28,30 +30,40 @@
 #include <iomanip>
 #include <stack>
 #include <climits>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <memory>
 using namespace std;
 
+// Number of source nodes a thread takes at a time in the parallel findShortestPath
+const int SOURCE_NODE_BLOCK = 16;
+
+// Tag at the start of a file written by saveLandmarks ("ALT2"), the files of the first
+// version had no checksum of the edges
+const int LANDMARK_FILE_TAG = 0x32544C41;
+
+// Weight passed to updateRows for an edge that does not exist
+const long long NO_EDGE = LLONG_MAX;
+
+// The automatic engine only uses a matrix for graphs with at most this many nodes and at least
+// this percentage of all the possible edges, and above the second percentage it picks the dense
+// engine over Floyd-Warshall, whose path entries take time proportional to the number of edges
+const int MATRIX_ENGINE_NODE_LIMIT = 4096;
+const int MATRIX_ENGINE_DENSITY = 5;
+const int DENSE_ENGINE_DENSITY = 25;
+
 // ---------------------------------[Constructor]---------------------------------------------
 // Description: The GraphM constructor initializes a new object of the GraphM
-// class and initializes the visited, dist, and path data members for the
-// nodes in the graph.
+// class with no nodes. The storage for the nodes, edges, and the table T is
+// sized by buildGraph once the number of nodes is known.
 // -------------------------------------------------------------------------------------------
 GraphM::GraphM() 
 {
-    // Iterate through the maximum number of nodes in the graph (100x100)
-    for (int i = 0; i < GRAPHM_MAXNODES; i++)
-    {
-        for (int j = 0; j < GRAPHM_MAXNODES; j++)
-        {
-            // Each node's visited status is set to false
-            T[i][j].visited = false;
-
-            // Each node's distance is set to infinity
-            T[i][j].dist = INT_MAX;
-
-            // Each path between the nodes is set to 0
-            T[i][j].path = 0;
-        }
-    }
+    // Graph size is initialized to 0
+    size = 0;
+    nonPositiveEdges = 0;
+    engine = AUTO_ENGINE;
 }
 // -------------------------------------------------------------------------------------------
 
@@ -62,43 +74,44 @@ GraphM::GraphM()
 // -------------------------------------------------------------------------------------------
 void GraphM::buildGraph(ifstream &inputfile)
 {
-    // Initialize the variables for the data of each node, source node, destination node, and distance
+    GRAPH_STATS_TIMER(readTimer, statistics.buildSeconds);
+
+    // Initialize the variables for the graph read in, source node, destination node, and distance
     // between nodes
-    string nodeData;
+    GraphText graph;
+    string restOfLine;
     int fromNode;
     int toNode;
     int distance;
 
     // Graph size is initialized to 0
-    size = 0;
+    graph.nodeCount = 0;
+
+    // Graph size is read in from the input data file
+    inputfile >> graph.nodeCount;
 
-    // The adjacency matrix representation of the graph is initialized with all
-    // the edge weights initialized to infinity
-    for (int i = 0; i < GRAPHM_MAXNODES; i++)
+    // A negative size is treated the same as an empty graph
+    if (graph.nodeCount < 0)
     {
-        for (int j = 0; j < GRAPHM_MAXNODES; j++)
-        {
-            C[i][j] = INT_MAX;
-        }
+        graph.nodeCount = 0;
     }
 
-    // Graph size is read in from the input data file
-    inputfile >> size;
-
-    // If the size of the graph is 0, return
-    if (size == 0) 
+    // If the size of the graph is 0, store the empty graph and return
+    if (graph.nodeCount == 0) 
     {
+        GRAPH_STATS_STOP(readTimer);
+        buildGraph(graph);
         return;
     }
 
     // The data for each node in the graph is read in through the
-    // input data text file and then stored in the NodeData array
-    getline(inputfile, nodeData);
+    // input data text file
+    getline(inputfile, restOfLine);
+    graph.descriptions.resize(graph.nodeCount);
 
-    for (int i = 1; i <= size; i++)
+    for (int i = 0; i < graph.nodeCount; i++)
     {
-        getline(inputfile, nodeData);
-        data[i] = NodeData(nodeData);
+        getline(inputfile, graph.descriptions[i]);
     }
 
     // Infinite loop until source or destination node are read in as 0
@@ -107,11 +120,11 @@ void GraphM::buildGraph(ifstream &inputfile)
         // Input data text file reads in the source node, destination node, and distance between the nodes
         inputfile >> fromNode >> toNode >> distance;
 
-        // If both nodes are not 0, store the distance read in as
-        // the distance between the two nodes
-        if (fromNode != 0 && toNode != 0)
+        // If both nodes are not 0 and are within the bounds of the graph, store the distance
+        // read in as the distance between the two nodes
+        if ((fromNode >= 1 && fromNode <= graph.nodeCount) && (toNode >= 1 && toNode <= graph.nodeCount))
         {
-            C[fromNode][toNode] = distance;
+            graph.edges.push_back({fromNode, toNode, distance});
         }
         
         // If either one of the nodes are 0, stop reading in input
@@ -120,12 +133,167 @@ void GraphM::buildGraph(ifstream &inputfile)
             break;
         }
     }
+
+    // The GraphText version times the rest of the build itself
+    GRAPH_STATS_STOP(readTimer);
+    buildGraph(graph);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[buildGraph]----------------------------------------------
+// Description: The GraphLoader version of the buildGraph method reads in the next graph
+// from the loader, which follows the same rules as the ifstream version, and stores it.
+// -------------------------------------------------------------------------------------------
+void GraphM::buildGraph(GraphLoader& loader)
+{
+    GRAPH_STATS_TIMER(readTimer, statistics.buildSeconds);
+    GraphText graph;
+    loader.readGraph(graph, true);
+    GRAPH_STATS_STOP(readTimer);
+    buildGraph(graph);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[buildGraph]----------------------------------------------
+// Description: The GraphText version of the buildGraph method, used by the other two
+// versions once they have read in the graph, sizes the storage for the graph from the
+// number of nodes, stores the data of each node and stores the edges in the CSR graph.
+// If the same edge was read in more than once the last distance read in is kept.
+// -------------------------------------------------------------------------------------------
+void GraphM::buildGraph(const GraphText& graph)
+{
+    GRAPH_STATS_TIMER(buildTimer, statistics.buildSeconds);
+    size = graph.nodeCount;
+
+    // The storage for the graph is sized from the number of nodes, subscript 0 is unused
+    data.assign(size + 1, NodeData());
+
+    for (int i = 1; i <= size; i++)
+    {
+        data[i] = NodeData(graph.descriptions[i - 1]);
+    }
+
+    // The edges read in are stored in the CSR graph, the reversed edges are built once
+    // here for the backward half of the bidirectional search
+    adjacency.build(size, graph.edges, false);
+    reverseAdjacency.buildReverse(adjacency);
+
+    // The search structures are sized for the new graph and no rows of T have been computed
+    nonPositiveEdges = countNonPositiveEdges();
+    repairMark.assign(size + 1, 0);
+    queryHeap.resize(size + 1);
+    forwardSearch.resize(size);
+    backwardSearch.resize(size);
+    clearRows();
+    clearPreprocessing();
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[saveSnapshot]---------------------------------------------
+// Description: The saveSnapshot method for the GraphM class writes the node descriptions,
+// the edges, the reversed edges and every row of T that has been computed for all of the
+// nodes to a snapshot file. Rows that shortestDistance stopped early on are not saved.
+// It returns false if the file could not be written.
+// -------------------------------------------------------------------------------------------
+bool GraphM::saveSnapshot(const string& fileName) const
+{
+    SnapshotContents contents;
+    contents.graphKind = GraphSnapshot::WEIGHTED_GRAPH;
+    contents.edges = &adjacency;
+    contents.reverseEdges = &reverseAdjacency;
+
+    for (int node = 1; node <= size; node++)
+    {
+        contents.descriptions.push_back(data[node].getData());
+    }
+
+    // The distance and path of every node in each complete row are stored one row after another
+    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    {
+        if (rowComplete[sourceNode] == 0)
+        {
+            continue;
+        }
+
+        contents.rowSources.push_back(sourceNode);
+
+        for (int node = 0; node <= size; node++)
+        {
+            contents.rowDistances.push_back(T[sourceNode].distance(node));
+            contents.rowPaths.push_back(T[sourceNode].path(node));
+        }
+    }
+
+    return GraphSnapshot::write(fileName, contents);
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[loadSnapshot]---------------------------------------------
+// Description: The loadSnapshot method for the GraphM class replaces the graph with the one
+// in a snapshot file written by saveSnapshot. The file is memory mapped and the CSR graphs
+// are views of its edge arrays, so nothing has to be parsed or sorted. The saved rows of T
+// are copied in and marked complete, in a complete row the nodes that were reached are the
+// visited ones. It returns false, and leaves the graph unchanged, if the file cannot be used.
+// -------------------------------------------------------------------------------------------
+bool GraphM::loadSnapshot(const string& fileName)
+{
+    GRAPH_STATS_TIMER(buildTimer, statistics.buildSeconds);
+    shared_ptr<GraphSnapshot> snapshot = make_shared<GraphSnapshot>();
+
+    if (!snapshot->open(fileName) || snapshot->graphKind() != GraphSnapshot::WEIGHTED_GRAPH)
+    {
+        return false;
+    }
+
+    size = snapshot->nodeCount();
+    data.assign(size + 1, NodeData());
+
+    for (int node = 1; node <= size; node++)
+    {
+        data[node] = NodeData(snapshot->description(node));
+    }
+
+    // The CSR graphs use the edge arrays of the mapped file, the snapshot is kept open by them
+    adjacency.view(size, snapshot->edgeCount(), snapshot->edgeOffsets(), snapshot->edgeTargets(),
+                   snapshot->edgeWeights(), snapshot);
+
+    if (snapshot->hasReverseEdges())
+    {
+        reverseAdjacency.view(size, snapshot->edgeCount(), snapshot->reverseOffsets(), snapshot->reverseTargets(),
+                              snapshot->reverseWeights(), snapshot);
+    }
+    else
+    {
+        reverseAdjacency.buildReverse(adjacency);
+    }
+
+    // The search structures are sized for the new graph
+    nonPositiveEdges = countNonPositiveEdges();
+    repairMark.assign(size + 1, 0);
+    queryHeap.resize(size + 1);
+    forwardSearch.resize(size);
+    backwardSearch.resize(size);
+    clearRows();
+    clearPreprocessing();
+
+    // The saved rows of T are copied in
+    for (int row = 0; row < snapshot->rowCount(); row++)
+    {
+        int sourceNode = snapshot->rowSource(row);
+        const int* distances = snapshot->rowDistances(row);
+        const int* paths = snapshot->rowPaths(row);
+        T[sourceNode].load(size, distances, paths);
+        rowComplete[sourceNode] = 1;
+    }
+    return true;
 }
 // -------------------------------------------------------------------------------------------
 
 // ---------------------------------[insertEdge]----------------------------------------------
 // Description: The insertEdge method for the GraphM class is used to 
-// insert an edge between two given nodes in the graph.
+// insert an edge between two given nodes in the graph, or to change the
+// weight of the edge if it is already there. The rows of T that have been
+// computed are repaired instead of being thrown away.
 // -------------------------------------------------------------------------------------------
 void GraphM::insertEdge(int fromNode, int toNode, int edgeWeight)
 {
@@ -138,29 +306,51 @@ void GraphM::insertEdge(int fromNode, int toNode, int edgeWeight)
     // If the source node and destination node are within the bounds of the graph
     if ((fromNode <= size && fromNode >= 1) && (toNode <= size && toNode >= 1))
     {
+        // The weight the edge had before, if it already existed
+        int edge = adjacency.findEdge(fromNode, toNode);
+        long long oldWeight = edge == -1 ? NO_EDGE : adjacency.edgeWeight(edge);
+        int oldNonPositiveEdges = nonPositiveEdges;
+
         // Initialize the edge weight for the edge between the souce node and destination node
-        C[fromNode][toNode] = edgeWeight;
+        adjacency.setEdge(fromNode, toNode, edgeWeight);
+        reverseAdjacency.setEdge(toNode, fromNode, edgeWeight);
+        nonPositiveEdges += (edgeWeight <= 0) - (oldWeight <= 0);
 
-        // Initialize the distance, path, and visited status of source node to destination node
-        T[fromNode][toNode].dist = INT_MAX;
-        T[fromNode][toNode].path = 0;
-        T[fromNode][toNode].visited = false;
+        // The shortest paths that have been found are repaired, the landmark distances and the
+        // contraction hierarchy are thrown away
+        updateRows(fromNode, toNode, oldWeight, edgeWeight, oldNonPositiveEdges > 0 || nonPositiveEdges > 0);
+        clearPreprocessing();
     }
 }
 // -------------------------------------------------------------------------------------------
 
 // ---------------------------------[removeEdge]----------------------------------------------
 // Description: The removeEdge method for the GraphM class removes an edge
-// between two given nodes by setting the edge weight between these nodes
-// to infinity.
+// between two given nodes by removing it from the CSR graph. The rows of T
+// that have been computed are repaired instead of being thrown away.
 // -------------------------------------------------------------------------------------------
 void GraphM::removeEdge(int fromNode, int toNode)
 {
-    // If the source node and destination node are within the bounds of the graph, set the edge weight from the source node
-    // to the destination node as infinity
+    // If the source node and destination node are within the bounds of the graph, the edge from the source node
+    // to the destination node is removed from the CSR graph
     if ((fromNode <= size && fromNode >= 1) && (toNode <= size && toNode >= 1))
     {
-        C[fromNode][toNode] = INT_MAX;
+        // The shortest paths that have been found are repaired, the landmark distances and the
+        // contraction hierarchy are thrown away
+        int edge = adjacency.findEdge(fromNode, toNode);
+
+        if (edge != -1)
+        {
+            long long oldWeight = adjacency.edgeWeight(edge);
+            int oldNonPositiveEdges = nonPositiveEdges;
+
+            adjacency.removeEdge(fromNode, toNode);
+            reverseAdjacency.removeEdge(toNode, fromNode);
+            nonPositiveEdges -= (oldWeight <= 0);
+
+            updateRows(fromNode, toNode, oldWeight, NO_EDGE, oldNonPositiveEdges > 0);
+            clearPreprocessing();
+        }
     }
 
     // If the source node or destination node are outside of the bounds of the graph, return
@@ -172,276 +362,1629 @@ void GraphM::removeEdge(int fromNode, int toNode)
 // -------------------------------------------------------------------------------------------
 
 
-// ------------------------------[findShortestPath]-------------------------------------------
-// Description: The findShortestPath method for the GraphM class finds the
-// shortest path between all of the nodes in the graph using Dijkstra's
-// shortest path algorithm. The algorithm works by starting from a source node
-// and updating the distance and path for all the neighbor nodes before choosing
-// the unvisited node with the shortest distance from the source node, then the distances
-// and paths are updated for the neighbor nodes and the process repeats until all nodes
-// are visited.
+// ---------------------------------[updateEdges]---------------------------------------------
+// Description: The updateEdges method for the GraphM class applies a batch of edge changes.
+// The changes are first reduced to the net change of each edge, changes to nodes outside of
+// the graph are skipped like insertEdge and removeEdge skip them. The edges are then rebuilt
+// in one pass over the CSR graph instead of moving the edges after every change, and each
+// computed row of T that one of the changes can affect is computed again, the other rows are
+// kept as they are. Rows that shortestDistance stopped early on are thrown away.
 // -------------------------------------------------------------------------------------------
-void GraphM::findShortestPath()
+void GraphM::updateEdges(const vector<EdgeUpdate>& updates)
 {
-    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    // The position of each update that is inside the graph, sorted by its edge so that the
+    // updates of the same edge are next to each other in the order they were given
+    vector<int> order;
+    order.reserve(updates.size());
+
+    for (int update = 0; update < static_cast<int>(updates.size()); update++)
     {
-        // The source node is set to visited and it's distance from itself is 0
-        T[sourceNode][sourceNode].visited = true;
-        T[sourceNode][sourceNode].dist = 0;
+        const EdgeUpdate& edgeUpdate = updates[update];
 
-        // The distances and paths for the neighbor nodes of the source node are updated
-        for (int neighborNode = 1; neighborNode <= size; neighborNode++)
+        if (edgeUpdate.fromNode >= 1 && edgeUpdate.fromNode <= size && edgeUpdate.toNode >= 1 && edgeUpdate.toNode <= size)
         {
-            // If there is not an edge from the source node to the neighbor node, skip that node
-            if (C[sourceNode][neighborNode] == INT_MAX)
-            {
-                continue;
-            }
+            order.push_back(update);
+        }
+    }
 
-            // If there is an edge from the source node to the neighbor node, update its distance and path
-            if (C[sourceNode][neighborNode] != INT_MAX)
-            {
-                T[sourceNode][neighborNode].dist = C[sourceNode][neighborNode];
-                T[sourceNode][neighborNode].path = sourceNode;
-            }
+    stable_sort(order.begin(), order.end(), [&updates](int first, int second)
+    {
+        if (updates[first].fromNode != updates[second].fromNode)
+        {
+            return updates[first].fromNode < updates[second].fromNode;
         }
+        return updates[first].toNode < updates[second].toNode;
+    });
 
-        // Iterate through all of the nodes that are unvisited in the graph
-        for (int visitedNodesCount = 1; visitedNodesCount < size; visitedNodesCount++)
+    // The last update of each edge decides its new weight, edges that end up unchanged are dropped
+    vector<EdgeChange> changes;
+
+    for (size_t next = 0; next < order.size(); next++)
+    {
+        const EdgeUpdate& edgeUpdate = updates[order[next]];
+
+        if (next + 1 < order.size() && updates[order[next + 1]].fromNode == edgeUpdate.fromNode &&
+            updates[order[next + 1]].toNode == edgeUpdate.toNode)
         {
+            continue;
+        }
 
-            // Initialize the shortest distance to infinity and current node to 0
-            int shortestDistance = INT_MAX;
-            int currentNode = 0;
+        int edge = adjacency.findEdge(edgeUpdate.fromNode, edgeUpdate.toNode);
+        long long oldWeight = edge == -1 ? NO_EDGE : adjacency.edgeWeight(edge);
+        long long newWeight = edgeUpdate.remove ? NO_EDGE : edgeUpdate.weight;
 
-            // Find the unvisited node in the graph that has the shortest distance from the source node
-            for (int unvisitedNode = 1; unvisitedNode <= size; unvisitedNode++)
-            {
-                // If the current shortest distance is larger than the distance from
-                // the source node to the unvisited node
-                if (shortestDistance > T[sourceNode][unvisitedNode].dist)
-                {
-                    if (T[sourceNode][unvisitedNode].visited == false)
-                    {
-                        // Set the new shortest distance and set unvisited node
-                        // to current node
-                        shortestDistance = T[sourceNode][unvisitedNode].dist;
-                        currentNode = unvisitedNode;
-                    }
-                }
-            }
+        if (oldWeight != newWeight)
+        {
+            changes.push_back({edgeUpdate.fromNode, edgeUpdate.toNode, oldWeight, newWeight});
+        }
+    }
 
-            // The new current node is marked as visited
-            T[sourceNode][currentNode].visited = true;
+    if (changes.empty())
+    {
+        return;
+    }
 
-            // The distances and paths of the nodes adjacent to the current node will be updated
-            for (int adjacentNode = 1; adjacentNode <= size; adjacentNode++)
-            {
-                // Check if there is an edge between the current and adjacent node
-                if (C[currentNode][adjacentNode] != INT_MAX)
-                {
-                    // Check if the adjacent node has not been visited yet
-                    if (T[sourceNode][adjacentNode].visited == false)
-                    {
-                        // If the distance from the source to current node + the edge weight between the current and adjacent node
-                        // is less than the current shortest distance from the source to adjacent node, then update the current
-                        // shortest distance to the adjacent node with this new shortest distance found and
-                        // set the current node as the new previous node to the adjacent node
-                        if ((T[sourceNode][currentNode].dist + C[currentNode][adjacentNode]) < T[sourceNode][adjacentNode].dist)
-                        {
-                            T[sourceNode][adjacentNode].dist = (T[sourceNode][currentNode].dist + C[currentNode][adjacentNode]);
-                            T[sourceNode][adjacentNode].path = currentNode;
-                        }
-                    }
-                }
-            }
+    int oldNonPositiveEdges = nonPositiveEdges;
+    applyEdgeChanges(changes);
+
+    // While there are edges with a weight of 0 or less every computed row is computed again,
+    // like in updateRows, otherwise only the rows the changes can affect
+    bool recompute = oldNonPositiveEdges > 0 || nonPositiveEdges > 0;
+
+    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    {
+        if (T[sourceNode].empty())
+        {
+            continue;
+        }
+
+        if (rowComplete[sourceNode] == 0)
+        {
+            T[sourceNode].clear();
+        }
+        else if (recompute || rowAffected(sourceNode, changes))
+        {
+            findShortestPathFromSource(sourceNode, queryHeap, statistics);
         }
     }
+
+    clearPreprocessing();
 }
 // -------------------------------------------------------------------------------------------
 
-// ---------------------------------[displayAll]----------------------------------------------
-// Description: The displayAll method for the GraphM class is used to print out the
-// shortest path between all of the nodes of a graph in the form of a table with the
-// columns "Description", "From node", "To node", "Dijkstra's", and "Path" to
-// display the node description, the source and destination nodes, the shortest path
-// to every destination node and the path it took to get from the source to destination
-// node.
+// ------------------------------[applyEdgeChanges]-------------------------------------------
+// Description: The applyEdgeChanges method for the GraphM class rebuilds the CSR graph and the
+// reversed CSR graph with the changes made to them. The changes are sorted by their edge.
+// Edges that are changed keep their position, removed edges are left out, and new edges are
+// placed after the other edges of their source node.
 // -------------------------------------------------------------------------------------------
-void GraphM::displayAll()
+void GraphM::applyEdgeChanges(const vector<EdgeChange>& changes)
 {
-    // The header row is printed to display the description, from node, to node, Dijkstra's, and path
-    cout << "Description" << "             ";
-    cout << "From node" << "   ";
-    cout << "To node" << "   ";
-    cout << "Dijkstra's" << "     ";
-    cout << "Path";
-    cout << endl;
-    
-    // Iterate through all the source nodes in the graph
-    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    vector<CsrEdge> edgeList;
+    edgeList.reserve(adjacency.edgeCount() + changes.size());
+
+    // changeOfTarget holds the change made to the edge to each destination node, for the node
+    // whose edges are being copied
+    vector<int> changeOfTarget(size + 1, -1);
+    size_t nextChange = 0;
+
+    for (int node = 1; node <= size; node++)
     {
-        // The data of the source node is printed out
-        cout << data[sourceNode];
-        cout << endl;
-        cout << endl;
+        size_t firstChange = nextChange;
 
-        // Iterate through all the destination nodes in the graph
-        for (int destinationNode = 1; destinationNode <= size; destinationNode++)
+        while (nextChange < changes.size() && changes[nextChange].fromNode == node)
         {
-            // Check if there is a path from the source node to the destination node
-            if (T[sourceNode][destinationNode].dist != 0)
-            {
-                cout << "                           ";
-                cout << sourceNode;
-                cout << "          ";
-                cout << destinationNode;
+            changeOfTarget[changes[nextChange].toNode] = static_cast<int>(nextChange);
+            nextChange++;
+        }
 
-               // If the path from the source node to the destination node is not infinity (path exists)
-               if (T[sourceNode][destinationNode].dist != INT_MAX)
-               {
-                    // The shortest path from the source node to the destination node is printed
-                    cout << "            ";
-                    cout << T[sourceNode][destinationNode].dist;
-                    cout << "          ";
+        // The edges of the node are copied with their new weights, removed edges are skipped
+        for (int edge = adjacency.beginEdge(node); edge < adjacency.endEdge(node); edge++)
+        {
+            int target = adjacency.edgeTarget(edge);
+            int change = changeOfTarget[target];
 
-                    // The path taken to get from the source node to the destination node is printed
-                    // by calling the recursivePathHelper method
-                    recursivePathHelper(sourceNode, destinationNode);
-                    cout << endl;
-               }
-               // If the path from the source node to the destination node is infinity (no path),
-               // "----" is printed
-               else if (T[sourceNode][destinationNode].dist == INT_MAX)
-               {
-                    cout << "            ";
-                    cout << "----";
-                    cout << endl;
-               }
+            if (change == -1)
+            {
+                edgeList.push_back({node, target, adjacency.edgeWeight(edge)});
+            }
+            else if (changes[change].newWeight != NO_EDGE)
+            {
+                edgeList.push_back({node, target, static_cast<int>(changes[change].newWeight)});
+            }
+        }
+
+        // The new edges of the node are added after them
+        for (size_t change = firstChange; change < nextChange; change++)
+        {
+            if (changes[change].oldWeight == NO_EDGE)
+            {
+                edgeList.push_back({node, changes[change].toNode, static_cast<int>(changes[change].newWeight)});
             }
+
+            nonPositiveEdges += (changes[change].newWeight <= 0) - (changes[change].oldWeight <= 0);
+            changeOfTarget[changes[change].toNode] = -1;
         }
     }
+
+    adjacency.build(size, edgeList, true);
+    reverseAdjacency.buildReverse(adjacency);
 }
 // -------------------------------------------------------------------------------------------
 
-// -----------------------------[recursivePathHelper]-----------------------------------------
-// Description: The recursivePathHelper method for the GraphM class is a recursive
-// helper method for the displayAll and display methods that finds the path between
-// the source node and destination node in the graph.
+// --------------------------------[rowAffected]----------------------------------------------
+// Description: The rowAffected method for the GraphM class returns true if the changes can
+// change the complete row of T of the source node. A lower weight matters if the edge starts
+// at a node that can be reached and gives its destination node a distance that is shorter
+// than or as short as the one it has, since a tie can change the path entry. A higher weight
+// or a removed edge only matters if the edge is the path entry of its destination node. If
+// no change matters, the distances in the row are still the shortest ones and every path
+// entry is still the first node on a shortest path, so the row does not change.
 // -------------------------------------------------------------------------------------------
-void GraphM::recursivePathHelper(int fromNode, int toNode)
+bool GraphM::rowAffected(int sourceNode, const vector<EdgeChange>& changes) const
 {
-    // If the source node and the destination node are equal, print the destination
-    // node as it is the only node in the path
-    if (toNode == fromNode || fromNode == toNode)
-    {
-        cout << toNode << " ";
-    }
+    const TableRow& row = T[sourceNode];
 
-    // If a path exists between the source node and destination node
-    else if (T[fromNode][toNode].dist != INT_MAX)
+    for (const EdgeChange& change : changes)
     {
-        // Store the current destination node in path
-        int path = toNode;
-
-        // Set the destination node to the previous node in the path
-        toNode = T[fromNode][toNode].path;
+        if (change.newWeight < change.oldWeight)
+        {
+            if (!row.visited(change.fromNode))
+            {
+                continue;
+            }
 
-        // Recursively call the helper method with the updated destination node
-        recursivePathHelper(fromNode, toNode);
+            int newDistance = WeightTraits<int>::extend(row.distance(change.fromNode), static_cast<int>(change.newWeight));
 
-        // Print out the current node
-        cout << path << " ";
+            if (newDistance != INT_MAX && (!row.visited(change.toNode) || newDistance <= row.distance(change.toNode)))
+            {
+                return true;
+            }
+        }
+        else if (row.visited(change.toNode) && row.path(change.toNode) == change.fromNode)
+        {
+            return true;
+        }
     }
+    return false;
+}
+// -------------------------------------------------------------------------------------------
 
-    // If the path from the source node to the destination node is infinity (no path), return
-    else
+// ---------------------------------[updateRows]----------------------------------------------
+// Description: The updateRows method for the GraphM class brings the rows of T up to date
+// after the weight of an edge changed, an edge that was inserted went down from NO_EDGE and
+// an edge that was removed went up to NO_EDGE. Rows that were only partly computed by
+// shortestDistance are thrown away. Each complete row is repaired by decreaseEdge or
+// increaseEdge, which only visit the nodes whose shortest paths change. While the graph has
+// edges with a weight of 0 or less the nodes are not visited in order of distance alone,
+// so recompute is true and the complete rows are computed again instead.
+// -------------------------------------------------------------------------------------------
+void GraphM::updateRows(int fromNode, int toNode, long long oldWeight, long long newWeight, bool recompute)
+{
+    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
     {
-        return;
+        if (T[sourceNode].empty())
+        {
+            continue;
+        }
+
+        if (rowComplete[sourceNode] == 0)
+        {
+            T[sourceNode].clear();
+        }
+        else if (recompute)
+        {
+            findShortestPathFromSource(sourceNode, queryHeap, statistics);
+        }
+        else if (newWeight < oldWeight)
+        {
+            decreaseEdge(sourceNode, fromNode, toNode, static_cast<int>(newWeight));
+        }
+        else if (newWeight > oldWeight)
+        {
+            increaseEdge(sourceNode, fromNode, toNode);
+        }
     }
 }
 // -------------------------------------------------------------------------------------------
 
-// -----------------------------------[display]-----------------------------------------------
-// Description: The display method for the GraphM class prints out the shortest path between 
-// the source node and the destination node in the graph, it additionally prints
-// out the cost of the path from the nodes and the data of the nodes.
+// --------------------------------[decreaseEdge]---------------------------------------------
+// Description: The decreaseEdge method for the GraphM class repairs the row of the source node
+// after the edge from fromNode to toNode got a smaller weight. If the edge now gives toNode a
+// shorter distance, Dijkstra's algorithm is run from toNode alone, and it only goes on to
+// the nodes whose distance gets shorter, every other distance in the row stays correct. The
+// path entries are then picked again for the nodes that changed and the nodes after them.
 // -------------------------------------------------------------------------------------------
-void GraphM::display(int fromNode, int toNode)
+void GraphM::decreaseEdge(int sourceNode, int fromNode, int toNode, int newWeight)
 {
-    // First check to make sure that the source node and destination node are within the size of the graph
-    if ((fromNode <= size && fromNode >= 0) && (toNode <= size && toNode >= 0))
+    TableRow& row = T[sourceNode];
+    repairNodes.clear();
+
+    // If fromNode can not be reached the edge is not on any path from the source node
+    if (!row.visited(fromNode))
     {
-        // Source node and destination node are printed
-        cout << "       " << fromNode << "       " << toNode;
-   
-        // If there is no path from the source node to the destination node,
-        // "----" is printed
-        if (T[fromNode][toNode].dist == INT_MAX)
+        return;
+    }
+
+    int newDistance = WeightTraits<int>::extend(row.distance(fromNode), newWeight);
+
+    // The edge may now tie with the path toNode already has, so its path entry is checked
+    repairNodes.push_back(toNode);
+
+    if (newDistance < row.distance(toNode))
+    {
+        queryHeap.clear();
+        row.setDistance(toNode, newDistance);
+        row.setVisited(toNode, true);
+        queryHeap.push(toNode, row.distance(toNode));
+
+        // The shorter distances are spread from toNode in order of distance
+        while (!queryHeap.empty())
         {
-            cout << "            " << "----" << endl;
-        }
-        // If there is a path between the two nodes
-        else
-        {   
-            // The shortest path between the source and destination node is printed 
-            cout << "            " << T[fromNode][toNode].dist << "            ";
+            int currentNode = queryHeap.popMin();
+            repairNodes.push_back(currentNode);
 
-            // Recursive helper method prints out the path taken from the source node to the destination node
-            recursivePathHelper(fromNode, toNode); 
-            cout << endl;
+            for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+            {
+                int adjacentNode = adjacency.edgeTarget(edge);
+                int distance = WeightTraits<int>::extend(row.distance(currentNode), adjacency.edgeWeight(edge));
 
-            // Recursive helper method prints out the data of the nodes in the path
-            recursiveNodeDataHelper(fromNode, toNode);
+                // A sum that saturated at infinity leaves the node unreached
+                if (distance != INT_MAX && (!row.visited(adjacentNode) || distance < row.distance(adjacentNode)))
+                {
+                    row.setDistance(adjacentNode, distance);
+                    row.setVisited(adjacentNode, true);
+                    queryHeap.push(adjacentNode, row.distance(adjacentNode));
+                }
+            }
         }
-        cout << endl;
-    }
-    // If either the source node or destination node are not within the bounds of the graph,
-    // print "----" to indicate there is no path between the nodes
-    else 
-    {
-        cout << "       " << fromNode << "       " << toNode << "            " << "----" << endl;
     }
+
+    repairPaths(sourceNode);
 }
 // -------------------------------------------------------------------------------------------
 
-// ---------------------------[recursiveNodeDataHelper]---------------------------------------
-// Description: The recursiveNodeDataHelper for the GraphM class is the recursive helper
-// method for the display method that is used to find the data of the node of a given
-// edge in the graph from the source node to the destination node.
+// --------------------------------[increaseEdge]---------------------------------------------
+// Description: The increaseEdge method for the GraphM class repairs the row of the source node
+// after the edge from fromNode to toNode got a larger weight or was removed. Only the nodes
+// whose path goes through the edge can change, and they are the subtree of toNode in the
+// shortest path tree formed by the path entries. Their distances are thrown away, each one
+// starts from the shortest way into it from a node outside of the subtree, and Dijkstra's
+// algorithm is run over the subtree. Nodes it does not reach can no longer be reached.
 // -------------------------------------------------------------------------------------------
-void GraphM::recursiveNodeDataHelper(int fromNode, int toNode)
+void GraphM::increaseEdge(int sourceNode, int fromNode, int toNode)
 {
-    // If the source node and destination node are equal, there is only
-    // one node in the path
-    if (toNode == fromNode || fromNode == toNode)
+    TableRow& row = T[sourceNode];
+    repairNodes.clear();
+
+    // If the edge was not the path entry of toNode, no shortest path went through it
+    if (!row.visited(toNode) || row.path(toNode) != fromNode)
     {
-        cout << data[toNode] << endl;
+        return;
     }
 
-    // If the path between the source node and destination node
-    // is not infinity, recursively find the data for each node in
-    // the path
-    else if (T[fromNode][toNode].dist != INT_MAX)
-    {
-        // The current destination node is stored in nodeData
-        int nodeData = toNode;
+    // The subtree of toNode is found by following the path entries forward from toNode
+    repairNodes.push_back(toNode);
+    repairMark[toNode] = 1;
 
-        // Destination node is updated to the next node in the path
-        toNode = T[fromNode][toNode].path;
+    for (size_t next = 0; next < repairNodes.size(); next++)
+    {
+        int currentNode = repairNodes[next];
 
-        // Recursive call with updated destination node
-        recursiveNodeDataHelper(fromNode, toNode);
+        for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+        {
+            int adjacentNode = adjacency.edgeTarget(edge);
 
-        // Print out the node data of the next node in the path
-        cout << data[nodeData] << endl;
-        cout << endl;
+            if (repairMark[adjacentNode] == 0 && row.visited(adjacentNode) && row.path(adjacentNode) == currentNode)
+            {
+                repairMark[adjacentNode] = 1;
+                repairNodes.push_back(adjacentNode);
+            }
+        }
     }
 
-    // If there is not a path from the source node to destination node, return
-    else
+    // Every node in the subtree loses its distance
+    for (int node : repairNodes)
     {
-        return;
+        row.setVisited(node, false);
+        row.setDistance(node, INT_MAX);
+        row.setPath(node, 0);
     }
+
+    // Each node in the subtree starts from the shortest edge into it from a node outside of it
+    queryHeap.clear();
+
+    for (int node : repairNodes)
+    {
+        int bestDistance = INT_MAX;
+
+        for (int edge = reverseAdjacency.beginEdge(node); edge < reverseAdjacency.endEdge(node); edge++)
+        {
+            int previousNode = reverseAdjacency.edgeTarget(edge);
+
+            if (row.visited(previousNode))
+            {
+                bestDistance = min(bestDistance, WeightTraits<int>::extend(row.distance(previousNode), reverseAdjacency.edgeWeight(edge)));
+            }
+        }
+
+        if (bestDistance < INT_MAX)
+        {
+            row.setDistance(node, bestDistance);
+            queryHeap.push(node, row.distance(node));
+        }
+    }
+
+    // Dijkstra's algorithm is run over the nodes of the subtree
+    while (!queryHeap.empty())
+    {
+        int currentNode = queryHeap.popMin();
+        row.setVisited(currentNode, true);
+
+        for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+        {
+            int adjacentNode = adjacency.edgeTarget(edge);
+            int distance = WeightTraits<int>::extend(row.distance(currentNode), adjacency.edgeWeight(edge));
+
+            if (repairMark[adjacentNode] == 1 && !row.visited(adjacentNode) && distance < row.distance(adjacentNode))
+            {
+                row.setDistance(adjacentNode, distance);
+                queryHeap.push(adjacentNode, row.distance(adjacentNode));
+            }
+        }
+    }
+
+    for (int node : repairNodes)
+    {
+        repairMark[node] = 0;
+    }
+
+    repairPaths(sourceNode);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[repairPaths]---------------------------------------------
+// Description: The repairPaths method for the GraphM class picks the path entry again for
+// every node in repairNodes and every node that an edge from one of them leads to, since
+// those are the only nodes whose distance, or the distance of a node before them, changed.
+// -------------------------------------------------------------------------------------------
+void GraphM::repairPaths(int sourceNode)
+{
+    for (int node : repairNodes)
+    {
+        choosePath(sourceNode, node);
+
+        for (int edge = adjacency.beginEdge(node); edge < adjacency.endEdge(node); edge++)
+        {
+            choosePath(sourceNode, adjacency.edgeTarget(edge));
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[choosePath]----------------------------------------------
+// Description: The choosePath method for the GraphM class sets the path entry of a node to
+// the one Dijkstra's algorithm would have given it. With every edge weight above 0 the nodes
+// are visited in order of distance and then node number, and a node's path entry is set by
+// the first visited node that gives it its shortest distance, so out of the nodes with an
+// edge into it that is on a shortest path, the one that comes first in that order is picked.
+// The source node keeps a path entry of 0, and so does a node that can not be reached.
+// -------------------------------------------------------------------------------------------
+void GraphM::choosePath(int sourceNode, int node)
+{
+    TableRow& row = T[sourceNode];
+
+    if (node == sourceNode || !row.visited(node))
+    {
+        return;
+    }
+
+    int bestNode = 0;
+
+    for (int edge = reverseAdjacency.beginEdge(node); edge < reverseAdjacency.endEdge(node); edge++)
+    {
+        int previousNode = reverseAdjacency.edgeTarget(edge);
+
+        if (!row.visited(previousNode) ||
+            WeightTraits<int>::extend(row.distance(previousNode), reverseAdjacency.edgeWeight(edge)) != row.distance(node))
+        {
+            continue;
+        }
+
+        if (bestNode == 0 || row.distance(previousNode) < row.distance(bestNode) ||
+            (row.distance(previousNode) == row.distance(bestNode) && previousNode < bestNode))
+        {
+            bestNode = previousNode;
+        }
+    }
+
+    row.setPath(node, bestNode);
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------[countNonPositiveEdges]----------------------------------------
+// Description: The countNonPositiveEdges method for the GraphM class returns the number of
+// edges with a weight of 0 or less.
+// -------------------------------------------------------------------------------------------
+int GraphM::countNonPositiveEdges() const
+{
+    int count = 0;
+
+    for (int node = 1; node <= size; node++)
+    {
+        for (int edge = adjacency.beginEdge(node); edge < adjacency.endEdge(node); edge++)
+        {
+            if (adjacency.edgeWeight(edge) <= 0)
+            {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[tableDistance]-------------------------------------------
+// Description: The tableDistance method for the GraphM class returns the shortest distance
+// from the source node to the destination node stored in T, or infinity if the destination
+// node has not been visited from the source node, either because there is no path or because
+// the row of the source node has not been computed that far yet.
+// -------------------------------------------------------------------------------------------
+int GraphM::tableDistance(int fromNode, int toNode) const
+{
+    if (T[fromNode].empty() || !T[fromNode].visited(toNode))
+    {
+        return INT_MAX;
+    }
+    return T[fromNode].distance(toNode);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[clearRows]-----------------------------------------------
+// Description: The clearRows method for the GraphM class throws away every row of T that has
+// been computed, it is called when the graph is built.
+// -------------------------------------------------------------------------------------------
+void GraphM::clearRows()
+{
+    T.assign(size + 1, TableRow());
+    rowComplete.assign(size + 1, 0);
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[findShortestPath]-------------------------------------------
+// Description: The findShortestPath method for the GraphM class finds the
+// shortest path between all of the nodes in the graph using Dijkstra's
+// shortest path algorithm. The algorithm works by starting from a source node
+// and updating the distance and path for all the neighbor nodes before choosing
+// the unvisited node with the shortest distance from the source node, then the distances
+// and paths are updated for the neighbor nodes and the process repeats until all nodes
+// are visited. A single heap is reused for every source node. With the dense engine the
+// matrix of edge weights is built first and the search from each source node scans it.
+// -------------------------------------------------------------------------------------------
+void GraphM::findShortestPath()
+{
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    ShortestPathEngine chosenEngine = selectedEngine();
+
+    if (chosenEngine == FLOYD_WARSHALL_ENGINE)
+    {
+        findShortestPathFloydWarshall(1);
+        return;
+    }
+
+    if (chosenEngine == DENSE_ENGINE)
+    {
+        DenseGraph denseGraph;
+        DenseWorkspace workspace;
+        denseGraph.build(adjacency);
+
+        for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+        {
+            denseGraph.shortestPaths(sourceNode, T[sourceNode], workspace);
+            rowComplete[sourceNode] = 1;
+        }
+        return;
+    }
+
+    IndexedHeap<4> heap(size + 1);
+
+    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    {
+        findShortestPathFromSource(sourceNode, heap, statistics);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[findShortestPath]-------------------------------------------
+// Description: The parallel findShortestPath method for the GraphM class fills in the same
+// table T as the serial version using several threads. Each source node only writes its
+// own row of T and only reads the CSR graph, so the source nodes are shared out between
+// the threads in blocks, a thread that finishes its block early takes the next one.
+// A threadCount of 0 uses one thread for each core of the machine. With the dense engine
+// the threads share one matrix of edge weights, which is only read.
+// -------------------------------------------------------------------------------------------
+void GraphM::findShortestPath(int threadCount)
+{
+    // A threadCount of 0 uses the number of cores, if it is unknown a single thread is used
+    if (threadCount <= 0)
+    {
+        threadCount = static_cast<int>(thread::hardware_concurrency());
+    }
+
+    // There is no point in starting more threads than there are blocks of source nodes
+    int blockCount = (size + SOURCE_NODE_BLOCK - 1) / SOURCE_NODE_BLOCK;
+
+    if (threadCount > blockCount)
+    {
+        threadCount = blockCount;
+    }
+
+    // With a single thread the serial version is used
+    if (threadCount <= 1)
+    {
+        findShortestPath();
+        return;
+    }
+
+    GRAPH_STATS_TIMER(computeTimer, statistics.computeSeconds);
+    ShortestPathEngine chosenEngine = selectedEngine();
+
+    if (chosenEngine == FLOYD_WARSHALL_ENGINE)
+    {
+        findShortestPathFloydWarshall(threadCount);
+        return;
+    }
+
+    // The matrix of the dense engine is built once for all of the threads
+    DenseGraph denseGraph;
+
+    if (chosenEngine == DENSE_ENGINE)
+    {
+        denseGraph.build(adjacency);
+    }
+
+    const DenseGraph* sharedGraph = chosenEngine == DENSE_ENGINE ? &denseGraph : nullptr;
+
+    // The next source node that has not been taken by a thread yet
+    atomic<int> nextSourceNode(1);
+
+    // Each thread counts its work on its own, the counts are added together once they are done
+    vector<GraphStats> workerCounters(threadCount);
+
+    // The threads are started and then waited on until all of the source nodes are done,
+    // the calling thread also works on the source nodes instead of only waiting
+    vector<thread> workers;
+
+    for (int workerIndex = 1; workerIndex < threadCount; workerIndex++)
+    {
+        workers.emplace_back(&GraphM::findShortestPathWorker, this, ref(nextSourceNode), sharedGraph,
+                             ref(workerCounters[workerIndex]));
+    }
+
+    findShortestPathWorker(nextSourceNode, sharedGraph, workerCounters[0]);
+
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const GraphStats& counters : workerCounters)
+    {
+        statistics.add(counters);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------[findShortestPathWorker]----------------------------------------
+// Description: The findShortestPathWorker method for the GraphM class is run by each
+// thread of the parallel findShortestPath. It takes the next block of source nodes and runs
+// Dijkstra's shortest path algorithm from each one with its own heap, or its own workspace
+// with the dense engine, and repeats until there are no source nodes left.
+// -------------------------------------------------------------------------------------------
+void GraphM::findShortestPathWorker(atomic<int>& nextSourceNode, const DenseGraph* denseGraph, GraphStats& counters)
+{
+    IndexedHeap<4> heap(denseGraph == nullptr ? size + 1 : 0);
+    DenseWorkspace workspace;
+
+    while (true)
+    {
+        // Take the next block of source nodes, stop once all of them have been taken
+        int firstSourceNode = nextSourceNode.fetch_add(SOURCE_NODE_BLOCK);
+
+        if (firstSourceNode > size)
+        {
+            break;
+        }
+
+        int lastSourceNode = min(firstSourceNode + SOURCE_NODE_BLOCK - 1, size);
+
+        for (int sourceNode = firstSourceNode; sourceNode <= lastSourceNode; sourceNode++)
+        {
+            if (denseGraph != nullptr)
+            {
+                denseGraph->shortestPaths(sourceNode, T[sourceNode], workspace);
+                rowComplete[sourceNode] = 1;
+            }
+            else
+            {
+                findShortestPathFromSource(sourceNode, heap, counters);
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[setEngine]----------------------------------------------
+// Description: The setEngine method for the GraphM class picks the engine findShortestPath
+// uses. The dense and Floyd-Warshall engines need memory for a full matrix, so they should
+// only be picked for graphs where most pairs of nodes have an edge.
+// -------------------------------------------------------------------------------------------
+void GraphM::setEngine(ShortestPathEngine newEngine)
+{
+    engine = newEngine;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[selectedEngine]-------------------------------------------
+// Description: The selectedEngine method for the GraphM class returns the engine that
+// findShortestPath runs. The Floyd-Warshall engine can not be used when the graph has an edge
+// with a weight of 0 or less or its distances could overflow, and then the dense engine is
+// used instead. The automatic engine uses the heap for large or sparse graphs, since a matrix
+// engine does O(V^3) work and needs O(V^2) memory however few edges there are. Floyd-Warshall
+// is used for graphs in between, and the dense engine for graphs with the most edges, where
+// picking the path entries from the distances costs Floyd-Warshall more than it saves.
+// -------------------------------------------------------------------------------------------
+ShortestPathEngine GraphM::selectedEngine() const
+{
+    if (engine == HEAP_ENGINE || engine == DENSE_ENGINE)
+    {
+        return engine;
+    }
+
+    if (engine == AUTO_ENGINE)
+    {
+        long long possibleEdges = static_cast<long long>(size) * size;
+        long long edgePercent = 100LL * adjacency.edgeCount();
+
+        if (size > MATRIX_ENGINE_NODE_LIMIT || edgePercent < MATRIX_ENGINE_DENSITY * possibleEdges)
+        {
+            return HEAP_ENGINE;
+        }
+
+        if (edgePercent >= DENSE_ENGINE_DENSITY * possibleEdges)
+        {
+            return DENSE_ENGINE;
+        }
+    }
+
+    return floydWarshallUsable() ? FLOYD_WARSHALL_ENGINE : DENSE_ENGINE;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------[floydWarshallUsable]-----------------------------------------
+// Description: The floydWarshallUsable method for the GraphM class returns true if every edge
+// weight is above 0 and no shortest path can reach the unreachable distance of FloydWarshall.
+// With weights above 0 the path entries picked from the distances are the same ones Dijkstra's
+// algorithm gives, and a shortest path has at most size - 1 edges.
+// -------------------------------------------------------------------------------------------
+bool GraphM::floydWarshallUsable() const
+{
+    if (nonPositiveEdges > 0)
+    {
+        return false;
+    }
+
+    long long largestWeight = 0;
+
+    for (int node = 1; node <= size; node++)
+    {
+        for (int edge = adjacency.beginEdge(node); edge < adjacency.endEdge(node); edge++)
+        {
+            largestWeight = max(largestWeight, static_cast<long long>(adjacency.edgeWeight(edge)));
+        }
+    }
+    return largestWeight * max(size - 1, 1) < FloydWarshall::UNREACHABLE;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------[findShortestPathFloydWarshall]-----------------------------------
+// Description: The findShortestPathFloydWarshall method for the GraphM class runs the blocked
+// Floyd-Warshall algorithm and copies the distances into every row of T, the nodes that can be
+// reached are the visited ones. The path entries are then picked with choosePath, which gives
+// each node the same path entry as Dijkstra's algorithm. The rows are shared out between the
+// threads like in the parallel findShortestPath, each thread only writes its own rows.
+// -------------------------------------------------------------------------------------------
+void GraphM::findShortestPathFloydWarshall(int threadCount)
+{
+    FloydWarshall allPairs;
+    allPairs.run(adjacency, threadCount);
+
+    atomic<int> nextSourceNode(1);
+
+    // Each thread takes the next block of source nodes and fills in their rows
+    auto fillRows = [this, &allPairs, &nextSourceNode]
+    {
+        for (int firstSourceNode = nextSourceNode.fetch_add(SOURCE_NODE_BLOCK); firstSourceNode <= size;
+             firstSourceNode = nextSourceNode.fetch_add(SOURCE_NODE_BLOCK))
+        {
+            int lastSourceNode = min(firstSourceNode + SOURCE_NODE_BLOCK - 1, size);
+
+            for (int sourceNode = firstSourceNode; sourceNode <= lastSourceNode; sourceNode++)
+            {
+                TableRow& row = T[sourceNode];
+                row.reset(size);
+
+                for (int node = 1; node <= size; node++)
+                {
+                    int distance = allPairs.distance(sourceNode, node);
+
+                    if (distance != INT_MAX)
+                    {
+                        row.setDistance(node, distance);
+                        row.setVisited(node, true);
+                    }
+                }
+
+                for (int node = 1; node <= size; node++)
+                {
+                    choosePath(sourceNode, node);
+                }
+
+                rowComplete[sourceNode] = 1;
+            }
+        }
+    };
+
+    vector<thread> workers;
+
+    for (int workerIndex = 1; workerIndex < threadCount; workerIndex++)
+    {
+        workers.emplace_back(fillRows);
+    }
+
+    fillRows();
+
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------[findShortestPathFromSource]-------------------------------------
+// Description: The findShortestPathFromSource method for the GraphM class runs Dijkstra's
+// shortest path algorithm from a single source node and fills in the whole row of T for
+// that source node.
+// -------------------------------------------------------------------------------------------
+void GraphM::findShortestPathFromSource(int sourceNode, IndexedHeap<4>& heap, GraphStats& counters)
+{
+    startRow(sourceNode, heap, counters);
+    visitNodes(sourceNode, 0, heap, counters);
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[startRow]-----------------------------------------------
+// Description: The startRow method for the GraphM class allocates the row of T for the source
+// node, or resets it so that Dijkstra's algorithm can be run from the source node again, and
+// puts the source node in the heap at a distance of 0.
+// -------------------------------------------------------------------------------------------
+void GraphM::startRow(int sourceNode, IndexedHeap<4>& heap, GraphStats& counters)
+{
+    // Every node in the row starts unvisited, at a distance of infinity and with a path of 0
+    T[sourceNode].reset(size);
+    rowComplete[sourceNode] = 0;
+
+    // The source node's distance from itself is 0
+    heap.clear();
+    T[sourceNode].setDistance(sourceNode, 0);
+    heap.push(sourceNode, 0);
+    GRAPH_STATS_ADD(counters, heapPushes, 1);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[visitNodes]----------------------------------------------
+// Description: The visitNodes method for the GraphM class is the main loop of Dijkstra's
+// shortest path algorithm. Instead of scanning every node to find the unvisited node with
+// the shortest distance, the reachable unvisited nodes are kept in a heap, and only the
+// edges stored in the CSR graph for each visited node are relaxed, so a whole row takes
+// O((V + E) log V) time instead of O(V^2). The method stops right after the target node
+// has been visited, or once the heap is empty, in which case the row is marked complete.
+// -------------------------------------------------------------------------------------------
+void GraphM::visitNodes(int sourceNode, int targetNode, IndexedHeap<4>& heap, GraphStats& counters)
+{
+    // Repeat until there are no more reachable unvisited nodes
+    while (!heap.empty())
+    {
+        // The unvisited node with the shortest distance from the source node is marked as visited,
+        // ties are broken by the smaller node number just like a scan from 1 to size
+        int currentNode = heap.popMin();
+        T[sourceNode].setVisited(currentNode, true);
+        GRAPH_STATS_ADD(counters, heapPops, 1);
+        GRAPH_STATS_ADD(counters, nodesSettled, 1);
+        GRAPH_STATS_ADD(counters, edgesRelaxed, adjacency.endEdge(currentNode) - adjacency.beginEdge(currentNode));
+
+        // The distances and paths of the nodes adjacent to the current node will be updated
+        for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+        {
+            int adjacentNode = adjacency.edgeTarget(edge);
+
+            // Skip the adjacent node if it has already been visited
+            if (T[sourceNode].visited(adjacentNode))
+            {
+                continue;
+            }
+
+            // If the distance from the source to current node + the edge weight between the current and adjacent node
+            // is less than the current shortest distance from the source to adjacent node, then update the current
+            // shortest distance to the adjacent node, set the current node as the new previous node to the adjacent
+            // node and add the adjacent node to the heap or decrease its distance in the heap
+            int newDistance = WeightTraits<int>::extend(T[sourceNode].distance(currentNode), adjacency.edgeWeight(edge));
+
+            if (newDistance < T[sourceNode].distance(adjacentNode))
+            {
+                // A node that already has a distance is in the heap, so its key is decreased
+                GRAPH_STATS_ADD(counters, heapPushes, T[sourceNode].distance(adjacentNode) == INT_MAX ? 1 : 0);
+                GRAPH_STATS_ADD(counters, decreaseKeys, T[sourceNode].distance(adjacentNode) == INT_MAX ? 0 : 1);
+                T[sourceNode].setDistance(adjacentNode, newDistance);
+                T[sourceNode].setPath(adjacentNode, currentNode);
+                heap.push(adjacentNode, newDistance);
+            }
+        }
+
+        // Stop early once the target node has been visited, its edges have already been relaxed
+        // so the row can be picked up again later from the unvisited nodes with a distance
+        if (currentNode == targetNode)
+        {
+            return;
+        }
+    }
+
+    // Every node that can be reached from the source node has been visited
+    rowComplete[sourceNode] = 1;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[shortestDistance]------------------------------------------
+// Description: The shortestDistance method for the GraphM class returns the shortest distance
+// from the source node to the destination node, or infinity if there is no path between them.
+// Instead of computing every row of T, Dijkstra's algorithm is only run from the source node
+// and it stops as soon as the destination node has been visited. The row is kept in T, so a
+// later query from the same source node to a node that has already been visited does no work,
+// and a query to a node further away carries on from where the last query stopped.
+// -------------------------------------------------------------------------------------------
+int GraphM::shortestDistance(int fromNode, int toNode)
+{
+    // If the source node or destination node are not within the bounds of the graph, there is no path
+    if (fromNode > size || fromNode < 1 || toNode > size || toNode < 1)
+    {
+        return INT_MAX;
+    }
+
+    // If the destination node has already been visited, or every reachable node has,
+    // the answer is already in T
+    if (!T[fromNode].empty() && (T[fromNode].visited(toNode) || rowComplete[fromNode] == 1))
+    {
+        return tableDistance(fromNode, toNode);
+    }
+
+    // A new row is started from the source node, otherwise the row is picked up again by putting
+    // every unvisited node that already has a distance back into the heap
+    if (T[fromNode].empty())
+    {
+        startRow(fromNode, queryHeap, statistics);
+    }
+    else
+    {
+        queryHeap.clear();
+
+        for (int node = 1; node <= size; node++)
+        {
+            if (!T[fromNode].visited(node) && T[fromNode].distance(node) != INT_MAX)
+            {
+                queryHeap.push(node, T[fromNode].distance(node));
+                GRAPH_STATS_ADD(statistics, heapPushes, 1);
+            }
+        }
+    }
+
+    visitNodes(fromNode, toNode, queryHeap, statistics);
+    return tableDistance(fromNode, toNode);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------[bidirectionalShortestPath]-------------------------------------
+// Description: The bidirectionalShortestPath method for the GraphM class finds the shortest
+// path from the source node to the destination node with two searches at once, a forward
+// Dijkstra's search from the source node over the edges and a backward search from the
+// destination node over the reversed edges. Each step visits a node in whichever search has
+// the shorter distance waiting, and whenever a node is reached by both searches the path
+// through it is compared with the shortest path found so far. The searches stop once the
+// two shortest waiting distances add up to at least the shortest path found, which usually
+// happens long before either search has visited the whole graph. The path is filled in with
+// the nodes from the source node to the destination node, when the shortest path is unique
+// it is the same path that display prints. The shortest distance is returned, or infinity
+// (with an empty path) if there is no path.
+// -------------------------------------------------------------------------------------------
+int GraphM::bidirectionalShortestPath(int fromNode, int toNode, vector<int>& path)
+{
+    path.clear();
+
+    // If the source node or destination node are not within the bounds of the graph, there is no path
+    if (fromNode > size || fromNode < 1 || toNode > size || toNode < 1)
+    {
+        return INT_MAX;
+    }
+
+    // Both searches start from their own end of the path at a distance of 0
+    forwardSearch.clear();
+    backwardSearch.clear();
+    forwardSearch.relax(fromNode, 0, 0);
+    backwardSearch.relax(toNode, 0, 0);
+
+    // Shortest path found so far and the node where the two searches met on it
+    int shortestDistance = (fromNode == toNode) ? 0 : INT_MAX;
+    int meetingNode = (fromNode == toNode) ? fromNode : 0;
+
+    while (true)
+    {
+        int forwardMinimum = forwardSearch.minDistance();
+        int backwardMinimum = backwardSearch.minDistance();
+
+        // Stop once either search has run out of nodes or no unvisited node can give a shorter path
+        if (forwardMinimum == INT_MAX || backwardMinimum == INT_MAX ||
+            static_cast<long long>(forwardMinimum) + backwardMinimum >= shortestDistance)
+        {
+            break;
+        }
+
+        // Step the forward search, relaxing the edges leaving the visited node
+        if (forwardMinimum <= backwardMinimum)
+        {
+            int currentNode = forwardSearch.visitNext();
+
+            for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+            {
+                int adjacentNode = adjacency.edgeTarget(edge);
+                int newDistance = WeightTraits<int>::extend(forwardSearch.distance(currentNode), adjacency.edgeWeight(edge));
+
+                // If the adjacent node got a shorter distance and the backward search has reached it,
+                // check if the path through it is the shortest found so far
+                if (forwardSearch.relax(adjacentNode, newDistance, currentNode) &&
+                    backwardSearch.distance(adjacentNode) != INT_MAX &&
+                    static_cast<long long>(newDistance) + backwardSearch.distance(adjacentNode) < shortestDistance)
+                {
+                    shortestDistance = newDistance + backwardSearch.distance(adjacentNode);
+                    meetingNode = adjacentNode;
+                }
+            }
+        }
+        // Step the backward search, relaxing the edges coming into the visited node
+        else
+        {
+            int currentNode = backwardSearch.visitNext();
+
+            for (int edge = reverseAdjacency.beginEdge(currentNode); edge < reverseAdjacency.endEdge(currentNode); edge++)
+            {
+                int adjacentNode = reverseAdjacency.edgeTarget(edge);
+                int newDistance = WeightTraits<int>::extend(backwardSearch.distance(currentNode), reverseAdjacency.edgeWeight(edge));
+
+                // If the adjacent node got a shorter distance and the forward search has reached it,
+                // check if the path through it is the shortest found so far
+                if (backwardSearch.relax(adjacentNode, newDistance, currentNode) &&
+                    forwardSearch.distance(adjacentNode) != INT_MAX &&
+                    static_cast<long long>(newDistance) + forwardSearch.distance(adjacentNode) < shortestDistance)
+                {
+                    shortestDistance = newDistance + forwardSearch.distance(adjacentNode);
+                    meetingNode = adjacentNode;
+                }
+            }
+        }
+    }
+
+    // If the searches never met there is no path
+    if (shortestDistance == INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    // The first half of the path is found by following the forward search back from the meeting node
+    // to the source node, then the second half follows the backward search on to the destination node
+    searchPath(forwardSearch, meetingNode, path);
+
+    for (int node = backwardSearch.previous(meetingNode); node != 0; node = backwardSearch.previous(node))
+    {
+        path.push_back(node);
+    }
+
+    return shortestDistance;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[searchPath]----------------------------------------------
+// Description: The searchPath method for the GraphM class fills the path with the nodes from
+// the node a search started at to the given node, by following the previous node of each
+// node back from the given node and then reversing the nodes found.
+// -------------------------------------------------------------------------------------------
+void GraphM::searchPath(const SearchSpace& search, int toNode, vector<int>& path) const
+{
+    path.clear();
+
+    for (int node = toNode; node != 0; node = search.previous(node))
+    {
+        path.push_back(node);
+    }
+    reverse(path.begin(), path.end());
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[setCoordinates]--------------------------------------------
+// Description: The setCoordinates method for the GraphM class sets the location of a node,
+// which the heuristics of aStarShortestPath use to estimate distances. Nodes outside of the
+// bounds of the graph are ignored.
+// -------------------------------------------------------------------------------------------
+void GraphM::setCoordinates(int node, double x, double y)
+{
+    if (node >= 1 && node <= size)
+    {
+        data[node].setCoordinates(x, y);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[allDistancesFrom]-------------------------------------------
+// Description: The allDistancesFrom method for the GraphM class runs Dijkstra's shortest path
+// algorithm from the source node over every node it can reach in the given graph, and stores
+// the distance of every node from the source node in distances (infinity if it cannot be
+// reached). Passing the reversed edges gives the distance from every node to the source node.
+// -------------------------------------------------------------------------------------------
+void GraphM::allDistancesFrom(const CsrGraph& graph, int sourceNode, SearchSpace& search, vector<int>& distances)
+{
+    search.clear();
+    search.relax(sourceNode, 0, 0);
+
+    while (!search.empty())
+    {
+        int currentNode = search.visitNext();
+
+        for (int edge = graph.beginEdge(currentNode); edge < graph.endEdge(currentNode); edge++)
+        {
+            search.relax(graph.edgeTarget(edge), WeightTraits<int>::extend(search.distance(currentNode), graph.edgeWeight(edge)), currentNode);
+        }
+    }
+
+    distances.resize(size + 1);
+
+    for (int node = 0; node <= size; node++)
+    {
+        distances[node] = search.distance(node);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------[preprocessLandmarks]-----------------------------------------
+// Description: The preprocessLandmarks method for the GraphM class picks the landmark nodes
+// used by landmarkShortestPath and stores the shortest distances between every landmark and
+// every node in both directions. The first landmark is the node furthest from node 1, and each
+// next landmark is the node furthest from the landmarks picked so far, with nodes that none of
+// them can reach picked first, which spreads the landmarks around the edges of the graph.
+// Each landmark takes one forward and one backward run of Dijkstra's algorithm.
+// -------------------------------------------------------------------------------------------
+void GraphM::preprocessLandmarks(int landmarkCount)
+{
+    clearLandmarks();
+
+    if (landmarkCount > size)
+    {
+        landmarkCount = size;
+    }
+
+    if (landmarkCount <= 0)
+    {
+        return;
+    }
+
+    // Distance of each node from the closest landmark picked so far, starting from node 1
+    vector<int> closestDistance;
+    allDistancesFrom(adjacency, 1, forwardSearch, closestDistance);
+
+    vector<vector<int>> forwardDistances(landmarkCount);
+    vector<vector<int>> backwardDistances(landmarkCount);
+
+    for (int landmarkIndex = 0; landmarkIndex < landmarkCount; landmarkIndex++)
+    {
+        // The next landmark is the node that is furthest from the landmarks picked so far,
+        // the smaller node number is picked when there is a tie
+        int nextLandmark = 0;
+
+        for (int node = 1; node <= size; node++)
+        {
+            if (find(landmarks.begin(), landmarks.end(), node) != landmarks.end())
+            {
+                continue;
+            }
+
+            if (nextLandmark == 0 || closestDistance[node] > closestDistance[nextLandmark])
+            {
+                nextLandmark = node;
+            }
+        }
+
+        landmarks.push_back(nextLandmark);
+
+        // The distances from the landmark to every node and from every node to the landmark
+        allDistancesFrom(adjacency, nextLandmark, forwardSearch, forwardDistances[landmarkIndex]);
+        allDistancesFrom(reverseAdjacency, nextLandmark, backwardSearch, backwardDistances[landmarkIndex]);
+
+        // The distances for picking the next landmark now include the new landmark
+        for (int node = 1; node <= size; node++)
+        {
+            closestDistance[node] = (landmarkIndex == 0) ? forwardDistances[landmarkIndex][node]
+                                  : min(closestDistance[node], forwardDistances[landmarkIndex][node]);
+        }
+    }
+
+    // The distances are stored with all of the distances for one node next to each other
+    fromLandmark.assign((size + 1) * landmarkCount, INT_MAX);
+    toLandmark.assign((size + 1) * landmarkCount, INT_MAX);
+
+    for (int node = 1; node <= size; node++)
+    {
+        for (int landmarkIndex = 0; landmarkIndex < landmarkCount; landmarkIndex++)
+        {
+            fromLandmark[node * landmarkCount + landmarkIndex] = forwardDistances[landmarkIndex][node];
+            toLandmark[node * landmarkCount + landmarkIndex] = backwardDistances[landmarkIndex][node];
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[clearLandmarks]--------------------------------------------
+// Description: The clearLandmarks method for the GraphM class throws away the landmarks and
+// their distances, it is called before new landmarks are picked or loaded. The contraction
+// hierarchy does not depend on the landmarks, so it is kept.
+// -------------------------------------------------------------------------------------------
+void GraphM::clearLandmarks()
+{
+    landmarks.clear();
+    fromLandmark.clear();
+    toLandmark.clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------[clearPreprocessing]------------------------------------------
+// Description: The clearPreprocessing method for the GraphM class throws away the landmarks
+// and their distances along with the contraction hierarchy, since both are preprocessed from
+// the edges, it is called when the graph is built or loaded and whenever an edge changes.
+// -------------------------------------------------------------------------------------------
+void GraphM::clearPreprocessing()
+{
+    clearLandmarks();
+    hierarchy.clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[landmarkEstimate]-------------------------------------------
+// Description: The landmarkEstimate method for the GraphM class estimates the distance from a
+// node to the destination node with the triangle inequality. For every landmark L, the path
+// from L to the destination node is at most as long as the path from L to the node and then
+// on to the destination node, and the path from the node to L is at most as long as the path
+// from the node to the destination node and then on to L. Either way the difference of the
+// two stored distances is never more than the real distance, and the largest difference over
+// all of the landmarks is returned. Distances of infinity give no estimate and are skipped.
+// -------------------------------------------------------------------------------------------
+int GraphM::landmarkEstimate(int node, int toNode) const
+{
+    int landmarkCount = static_cast<int>(landmarks.size());
+    const int* nodeFrom = &fromLandmark[node * landmarkCount];
+    const int* nodeTo = &toLandmark[node * landmarkCount];
+    const int* targetFrom = &fromLandmark[toNode * landmarkCount];
+    const int* targetTo = &toLandmark[toNode * landmarkCount];
+    int estimate = 0;
+
+    for (int landmarkIndex = 0; landmarkIndex < landmarkCount; landmarkIndex++)
+    {
+        // dist(node, toNode) >= dist(L, toNode) - dist(L, node)
+        if (targetFrom[landmarkIndex] != INT_MAX && nodeFrom[landmarkIndex] != INT_MAX)
+        {
+            estimate = max(estimate, targetFrom[landmarkIndex] - nodeFrom[landmarkIndex]);
+        }
+
+        // dist(node, toNode) >= dist(node, L) - dist(toNode, L)
+        if (nodeTo[landmarkIndex] != INT_MAX && targetTo[landmarkIndex] != INT_MAX)
+        {
+            estimate = max(estimate, nodeTo[landmarkIndex] - targetTo[landmarkIndex]);
+        }
+    }
+
+    return estimate;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------[landmarkShortestPath]-----------------------------------------
+// Description: The landmarkShortestPath method for the GraphM class finds the shortest path from
+// the source node to the destination node with an A* search whose estimates come from the
+// landmark distances stored by preprocessLandmarks. If there are no landmarks every estimate
+// is 0 and the search is the same as Dijkstra's algorithm.
+// -------------------------------------------------------------------------------------------
+int GraphM::landmarkShortestPath(int fromNode, int toNode, vector<int>& path)
+{
+    path.clear();
+
+    // If the source node or destination node are not within the bounds of the graph, there is no path
+    if (fromNode > size || fromNode < 1 || toNode > size || toNode < 1)
+    {
+        return INT_MAX;
+    }
+
+    if (landmarks.empty())
+    {
+        return aStarSearch(fromNode, toNode, path, [](int) { return 0; });
+    }
+
+    return aStarSearch(fromNode, toNode, path, [&](int node) { return landmarkEstimate(node, toNode); });
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------[buildContractionHierarchy]--------------------------------------
+// Description: The buildContractionHierarchy method for the GraphM class preprocesses the
+// edges of the graph into a contraction hierarchy for hierarchyShortestPath. It only has to
+// be run again after the edges change.
+// -------------------------------------------------------------------------------------------
+void GraphM::buildContractionHierarchy()
+{
+    hierarchy.build(adjacency);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------[hasContractionHierarchy]---------------------------------------
+// Description: The hasContractionHierarchy method for the GraphM class returns true if the
+// contraction hierarchy has been built and the edges have not changed since then.
+// -------------------------------------------------------------------------------------------
+bool GraphM::hasContractionHierarchy() const
+{
+    return hierarchy.isBuilt();
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------[hierarchyShortestPath]----------------------------------------
+// Description: The hierarchyShortestPath method for the GraphM class finds the shortest path
+// from the source node to the destination node with the contraction hierarchy, the path is
+// unpacked into the nodes of the graph in the same order that display prints them. If the
+// hierarchy has not been built, bidirectionalShortestPath is used instead.
+// -------------------------------------------------------------------------------------------
+int GraphM::hierarchyShortestPath(int fromNode, int toNode, vector<int>& path)
+{
+    if (!hierarchy.isBuilt())
+    {
+        return bidirectionalShortestPath(fromNode, toNode, path);
+    }
+
+    return hierarchy.shortestPath(fromNode, toNode, path);
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[saveLandmarks]--------------------------------------------
+// Description: The saveLandmarks method for the GraphM class writes the landmarks and their
+// distances to a binary file so that preprocessLandmarks does not have to be run every time
+// the graph is loaded. The file starts with a tag, the number of nodes and edges of the graph,
+// the number of landmarks and the checksum of the edges, followed by the landmark nodes and
+// the two distance tables. It returns false if the file could not be written.
+// -------------------------------------------------------------------------------------------
+bool GraphM::saveLandmarks(const string& fileName) const
+{
+    ofstream outputfile(fileName, ios::binary);
+
+    if (!outputfile)
+    {
+        return false;
+    }
+
+    // The header identifies the file and the graph that it was written for
+    int header[4] = {LANDMARK_FILE_TAG, size, adjacency.edgeCount(), static_cast<int>(landmarks.size())};
+    unsigned long long edgeChecksum = adjacency.checksum();
+    outputfile.write(reinterpret_cast<const char*>(header), sizeof(header));
+    outputfile.write(reinterpret_cast<const char*>(&edgeChecksum), sizeof(edgeChecksum));
+
+    // The landmark nodes and distance tables are written as they are stored in memory
+    outputfile.write(reinterpret_cast<const char*>(landmarks.data()), landmarks.size() * sizeof(int));
+    outputfile.write(reinterpret_cast<const char*>(fromLandmark.data()), fromLandmark.size() * sizeof(int));
+    outputfile.write(reinterpret_cast<const char*>(toLandmark.data()), toLandmark.size() * sizeof(int));
+
+    return static_cast<bool>(outputfile);
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[loadLandmarks]--------------------------------------------
+// Description: The loadLandmarks method for the GraphM class reads the landmarks and their
+// distances from a file written by saveLandmarks. It returns false, and leaves the graph
+// without landmarks, if the file cannot be read or if the number of nodes or edges or the
+// checksum of the edges in the file does not match this graph. Landmarks of a different
+// graph could estimate a distance as longer than it is, and then ALT finds wrong paths.
+// -------------------------------------------------------------------------------------------
+bool GraphM::loadLandmarks(const string& fileName)
+{
+    clearLandmarks();
+    ifstream inputfile(fileName, ios::binary);
+
+    if (!inputfile)
+    {
+        return false;
+    }
+
+    // The header must have the right tag and match the size and the edges of this graph
+    int header[4];
+    unsigned long long edgeChecksum = 0;
+    inputfile.read(reinterpret_cast<char*>(header), sizeof(header));
+    inputfile.read(reinterpret_cast<char*>(&edgeChecksum), sizeof(edgeChecksum));
+
+    if (!inputfile || header[0] != LANDMARK_FILE_TAG || header[1] != size ||
+        header[2] != adjacency.edgeCount() || header[3] < 0 || header[3] > size ||
+        edgeChecksum != adjacency.checksum())
+    {
+        return false;
+    }
+
+    int landmarkCount = header[3];
+    landmarks.resize(landmarkCount);
+    fromLandmark.resize((size + 1) * landmarkCount);
+    toLandmark.resize((size + 1) * landmarkCount);
+
+    inputfile.read(reinterpret_cast<char*>(landmarks.data()), landmarks.size() * sizeof(int));
+    inputfile.read(reinterpret_cast<char*>(fromLandmark.data()), fromLandmark.size() * sizeof(int));
+    inputfile.read(reinterpret_cast<char*>(toLandmark.data()), toLandmark.size() * sizeof(int));
+
+    // If the file ended early, the partly read landmarks are thrown away
+    if (!inputfile)
+    {
+        clearLandmarks();
+        return false;
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[getPath]-----------------------------------------------
+// Description: The getPath method for the GraphM class fills path with the nodes on the
+// shortest path from the source node to the destination node and returns its distance. The
+// path is found with shortestDistance if it is not already in T. If there is no path, or
+// either node is outside of the graph, the path is left empty and infinity is returned.
+// -------------------------------------------------------------------------------------------
+int GraphM::getPath(int fromNode, int toNode, vector<int>& path)
+{
+    path.clear();
+
+    if (shortestDistance(fromNode, toNode) == INT_MAX)
+    {
+        return INT_MAX;
+    }
+    return tablePath(fromNode, toNode, path);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[getPath]-----------------------------------------------
+// Description: This version of the getPath method also fills pathData with a pointer to the
+// data of each node on the path, in the same order as the nodes. The pointers stay valid
+// until the graph is built again.
+// -------------------------------------------------------------------------------------------
+int GraphM::getPath(int fromNode, int toNode, vector<int>& path, vector<const NodeData*>& pathData)
+{
+    int distance = getPath(fromNode, toNode, path);
+    pathData.clear();
+
+    for (int node : path)
+    {
+        pathData.push_back(&data[node]);
+    }
+    return distance;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[tablePath]----------------------------------------------
+// Description: The tablePath method for the GraphM class fills path with the nodes on the
+// shortest path stored in T, without computing anything. It follows the path entries back
+// from the destination node in a single loop and then reverses the nodes found. It returns
+// the distance of the path, or infinity with an empty path if the path is not in T. A chain
+// longer than the number of nodes can only come from a damaged table, so it is cut off.
+// -------------------------------------------------------------------------------------------
+int GraphM::tablePath(int fromNode, int toNode, vector<int>& path) const
+{
+    path.clear();
+
+    if (tableDistance(fromNode, toNode) == INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    for (int node = toNode; node != fromNode && static_cast<int>(path.size()) < size; node = T[fromNode].path(node))
+    {
+        path.push_back(node);
+    }
+
+    path.push_back(fromNode);
+    reverse(path.begin(), path.end());
+    return T[fromNode].distance(toNode);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[displayAll]----------------------------------------------
+// Description: The stream version of the displayAll method collects the table in an output
+// buffer and writes it to the stream in large chunks once the table is done, the stream is
+// not flushed.
+// -------------------------------------------------------------------------------------------
+void GraphM::displayAll(ostream& output)
+{
+    OutputBuffer buffer(output);
+    displayAll(buffer);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[displayAll]----------------------------------------------
+// Description: The displayAll method for the GraphM class is used to print out the
+// shortest path between all of the nodes of a graph in the form of a table with the
+// columns "Description", "From node", "To node", "Dijkstra's", and "Path" to
+// display the node description, the source and destination nodes, the shortest path
+// to every destination node and the path it took to get from the source to destination
+// node.
+// -------------------------------------------------------------------------------------------
+void GraphM::displayAll(OutputBuffer& output)
+{
+    GRAPH_STATS_TIMER(displayTimer, statistics.displaySeconds);
+
+    // The header row is printed to display the description, from node, to node, Dijkstra's, and path
+    output << "Description" << "             ";
+    output << "From node" << "   ";
+    output << "To node" << "   ";
+    output << "Dijkstra's" << "     ";
+    output << "Path";
+    output << '\n';
+    
+    // The nodes on each path are extracted into the same vector, so it is only allocated once
+    vector<int> path;
+
+    // Iterate through all the source nodes in the graph
+    for (int sourceNode = 1; sourceNode <= size; sourceNode++)
+    {
+        // The data of the source node is printed out
+        output << data[sourceNode].getData();
+        output << '\n';
+        output << '\n';
+
+        // Iterate through all the destination nodes in the graph
+        for (int destinationNode = 1; destinationNode <= size; destinationNode++)
+        {
+            // Check if there is a path from the source node to the destination node
+            if (tableDistance(sourceNode, destinationNode) != 0)
+            {
+                output << "                           ";
+                output << sourceNode;
+                output << "          ";
+                output << destinationNode;
+
+               // If the path from the source node to the destination node is not infinity (path exists)
+               if (tableDistance(sourceNode, destinationNode) != INT_MAX)
+               {
+                    // The shortest path from the source node to the destination node is printed
+                    output << "            ";
+                    output << T[sourceNode].distance(destinationNode);
+                    output << "          ";
+
+                    // The path taken to get from the source node to the destination node is printed
+                    // after extracting it from T with the tablePath method
+                    tablePath(sourceNode, destinationNode, path);
+
+                    for (int node : path)
+                    {
+                        output << node << " ";
+                    }
+                    output << '\n';
+               }
+               // If the path from the source node to the destination node is infinity (no path),
+               // "----" is printed
+               else if (tableDistance(sourceNode, destinationNode) == INT_MAX)
+               {
+                    output << "            ";
+                    output << "----";
+                    output << '\n';
+               }
+            }
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[display]-----------------------------------------------
+// Description: The stream version of the display method collects the text in an output
+// buffer and writes it to the stream when it is done, the stream is not flushed.
+// -------------------------------------------------------------------------------------------
+void GraphM::display(int fromNode, int toNode, ostream& output)
+{
+    OutputBuffer buffer(output);
+    display(fromNode, toNode, buffer);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[display]-----------------------------------------------
+// Description: The display method for the GraphM class prints out the shortest path between 
+// the source node and the destination node in the graph, it additionally prints
+// out the cost of the path from the nodes and the data of the nodes. The path is
+// found with shortestDistance, so findShortestPath does not have to be called first.
+// -------------------------------------------------------------------------------------------
+void GraphM::display(int fromNode, int toNode, OutputBuffer& output)
+{
+    GRAPH_STATS_TIMER(displayTimer, statistics.displaySeconds);
+
+    // First check to make sure that the source node and destination node are within the size of the graph
+    if ((fromNode <= size && fromNode >= 0) && (toNode <= size && toNode >= 0))
+    {
+        // The shortest path and the data of its nodes are extracted, the path is only
+        // found with shortestDistance if it is not already in T
+        vector<int> path;
+        vector<const NodeData*> pathData;
+        int distance = getPath(fromNode, toNode, path, pathData);
+
+        // Source node and destination node are printed
+        output << "       " << fromNode << "       " << toNode;
+   
+        // If there is no path from the source node to the destination node,
+        // "----" is printed
+        if (distance == INT_MAX)
+        {
+            output << "            " << "----" << '\n';
+        }
+        // If there is a path between the two nodes
+        else
+        {   
+            // The shortest path between the source and destination node is printed 
+            output << "            " << distance << "            ";
+
+            // The path taken from the source node to the destination node is printed
+            for (int node : path)
+            {
+                output << node << " ";
+            }
+            output << '\n';
+
+            // The data of the nodes in the path is printed, every node after the
+            // source node is followed by a blank line
+            for (size_t i = 0; i < pathData.size(); i++)
+            {
+                output << pathData[i]->getData() << '\n';
+
+                if (i > 0)
+                {
+                    output << '\n';
+                }
+            }
+        }
+        output << '\n';
+    }
+    // If either the source node or destination node are not within the bounds of the graph,
+    // print "----" to indicate there is no path between the nodes
+    else 
+    {
+        output << "       " << fromNode << "       " << toNode << "            " << "----" << '\n';
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[getStats]----------------------------------------------
+// Description: The getStats method for the GraphM class returns the counters of Dijkstra's
+// algorithm and the timings of the build, compute and display phases kept since the graph
+// was created or resetStats was last called. They are only kept when the program is compiled
+// with GRAPH_STATS defined, otherwise every field is 0.
+// -------------------------------------------------------------------------------------------
+const GraphStats& GraphM::getStats() const
+{
+    return statistics;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[resetStats]---------------------------------------------
+// Description: The resetStats method for the GraphM class sets the counters and timings back
+// to 0, so that the stats read after the next query only hold the work of that query.
+// -------------------------------------------------------------------------------------------
+void GraphM::resetStats()
+{
+    statistics.reset();
 }
 // -------------------------------------------------------------------------------------------
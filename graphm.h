@@ -2,87 +2,411 @@
 // David Schurer
 // CSS 343
 // Creation Date: 4/27/2023
-// Date of Last Modification: 5/5/2023
+// Date of Last Modification: 10/17/2026
 // ---------------------------------------------------------------------
 // Purpose - The graphm.h file is the header file for the GraphM
 // class, which is the implementation for Dijkstra's shortest path
 // algorithm. This header file provides the class definition for graphM
-// including all of its method declarations and data members, as well as
-// the private struct TableType, which stores the information for each
+// including all of its method declarations and data members. The rows of
+// the table T are TableRow objects, which store the information for each
 // node in the graph.
 // ---------------------------------------------------------------------
-// Notes - This header file initializes a global constant integer 
-// variable named MAXNODES and sets it to 100, this represents the maximum
-// number of nodes that can be stored in a given graph. Additionally, the
+// Notes - The storage for the graph is sized from the number of nodes
+// read in by buildGraph, so there is no maximum number of nodes. The edges
+// are stored in a compressed sparse row graph and each row of the table T is only
+// allocated once the shortest paths from that source node have been
+// computed. Each row keeps its distances, path entries and visited bits
+// in separate arrays, the descriptions of the nodes are only kept once in
+// data instead of in every entry of T. Additionally, the
 // buildGraph method passes in an ifstream object inputfile by reference
 // as its parameter as this method reads in a data input text file which
 // contains the number of nodes in the graph, each node description, and
-// the edge weights between the nodes in the graph.
+// the edge weights between the nodes in the graph. A graph can also be
+// saved to and loaded from a binary snapshot file, which skips the text
+// parsing and, for the rows of T that were saved, Dijkstra's algorithm.
+// The rows of T that have been computed are kept up to date when an edge
+// is inserted, removed or has its weight changed, only the nodes whose
+// shortest paths change are visited again. A batch of edge changes is
+// applied with updateEdges, which rebuilds the edges once and computes
+// again only the rows of T that the changes can affect. findShortestPath
+// can also run on a dense engine, which keeps the edge weights in a full
+// matrix and scans it with SIMD kernels, or on a blocked Floyd-Warshall
+// engine that computes every row at once. By default the engine is picked
+// from the number of nodes and the edge density of the graph. When the
+// program is compiled with GRAPH_STATS defined, the graph counts the work
+// done by the heap engine's Dijkstra's algorithm and times the build,
+// compute and display phases, see graphstats.h.
 // ---------------------------------------------------------------------
 #ifndef GRAPH_M
 #define GRAPH_M
 #include "nodedata.h"
+#include "indexedheap.h"
+#include "csrgraph.h"
+#include "searchspace.h"
+#include "contractionhierarchy.h"
+#include "graphloader.h"
+#include "graphsnapshot.h"
+#include "outputbuffer.h"
+#include "tablerow.h"
+#include "densegraph.h"
+#include "floydwarshall.h"
+#include "graphstats.h"
+#include "weighttraits.h"
 #include <iostream>
 #include <fstream>
 #include <climits>
+#include <vector>
+#include <atomic>
+#include <string>
 using namespace std;
 
-// Global constant int variable to represent the max number of nodes in the graph
-const int GRAPHM_MAXNODES = 100;
+// The EdgeUpdate struct represents one change in a batch given to GraphM::updateEdges, the
+// edge from fromNode to toNode is removed if remove is true, otherwise it is inserted or has
+// its weight changed to weight
+struct EdgeUpdate
+{
+    int fromNode;
+    int toNode;
+    int weight;
+    bool remove;
+};
+
+// The ShortestPathEngine enum picks how findShortestPath computes the rows of T, HEAP_ENGINE
+// uses a heap over the CSR graph, DENSE_ENGINE scans a full matrix of edge weights with SIMD
+// kernels, FLOYD_WARSHALL_ENGINE runs the blocked Floyd-Warshall algorithm over that matrix
+// and AUTO_ENGINE picks one of them from the size and edge density of the graph. All of the
+// engines give the same table
+enum ShortestPathEngine
+{
+    HEAP_ENGINE,
+    DENSE_ENGINE,
+    FLOYD_WARSHALL_ENGINE,
+    AUTO_ENGINE
+};
 
 class GraphM {
 
     public:
-        // GraphM default constructor initializes the data member T to set all the distances to infinity,
-        // all visited to false, all paths to 0
+        // GraphM default constructor creates an empty graph with no nodes
         GraphM(); 
 
         // buildGraph reads in the input data text file to build the graph                          
         void buildGraph(ifstream &inputfile);
 
+        // Version of buildGraph that builds the graph from a graph that has already been read in
+        void buildGraph(const GraphText& graph);
+
+        // Version of buildGraph that reads the next graph from a GraphLoader, which is much
+        // faster for large input files
+        void buildGraph(GraphLoader& loader);
+
+        // Methods for writing the graph and the computed rows of T to a binary snapshot file and
+        // loading it back, loadSnapshot maps the file and uses its edges in place, both return
+        // false if the file cannot be used
+        bool saveSnapshot(const string& fileName) const;
+        bool loadSnapshot(const string& fileName);
+
         // Methods for inserting and removing an edge between two nodes
         void insertEdge(int fromNode, int toNode, int edgeWeight);
         void removeEdge(int fromNode, int toNode);
+
+        // updateEdges applies a batch of edge inserts, removals and weight changes in order,
+        // as if each one was made with insertEdge or removeEdge, then brings T up to date once
+        void updateEdges(const vector<EdgeUpdate>& updates);
         
         // Implementation of Dijkstra's shortest path algorithm to find the shortest distances
-        // between all of the nodes in the graph
+        // between all of the nodes in the graph, using a 4-ary heap over the CSR edge arrays or
+        // the engine picked with setEngine
         void findShortestPath();
 
+        // Parallel version of findShortestPath that splits the source nodes between threadCount
+        // threads, a threadCount of 0 uses one thread for each core of the machine
+        void findShortestPath(int threadCount);
+
+        // setEngine picks the engine findShortestPath uses, AUTO_ENGINE is used by default, and
+        // selectedEngine returns the engine findShortestPath would run on the graph as it is now
+        void setEngine(ShortestPathEngine newEngine);
+        ShortestPathEngine selectedEngine() const;
+
+        // shortestDistance returns the shortest distance from fromNode to toNode, or infinity if
+        // there is no path. Only the row of fromNode is computed, and only until toNode is reached,
+        // the row is kept so that later queries from the same source node reuse it
+        int shortestDistance(int fromNode, int toNode);
+
+        // bidirectionalShortestPath returns the shortest distance from fromNode to toNode, or infinity
+        // if there is no path, and fills path with the nodes on the path from fromNode to toNode.
+        // A forward search from fromNode and a backward search from toNode meet in the middle
+        int bidirectionalShortestPath(int fromNode, int toNode, vector<int>& path);
+
+        // aStarShortestPath returns the shortest distance from fromNode to toNode, or infinity if there
+        // is no path, and fills path with the nodes on the path. The heuristic estimates the distance
+        // left to toNode, see heuristics.h, and must never estimate more than the real distance
+        template <typename Heuristic>
+        int aStarShortestPath(int fromNode, int toNode, vector<int>& path, Heuristic heuristic);
+
+        // setCoordinates sets the location of a node, which the A* search heuristics use
+        void setCoordinates(int node, double x, double y);
+
+        // preprocessLandmarks picks landmarkCount landmark nodes and stores the shortest distances
+        // from every landmark to every node and from every node to every landmark
+        void preprocessLandmarks(int landmarkCount);
+
+        // Methods for writing the landmark distances to a file and reading them back, they return
+        // false if the file cannot be used, or if it was written for a different graph
+        bool saveLandmarks(const string& fileName) const;
+        bool loadLandmarks(const string& fileName);
+
+        // landmarkShortestPath returns the shortest distance from fromNode to toNode, or infinity if
+        // there is no path, and fills path with the nodes on the path. It is an A* search that
+        // estimates distances from the landmark distances (ALT), so no coordinates are needed
+        int landmarkShortestPath(int fromNode, int toNode, vector<int>& path);
+
+        // buildContractionHierarchy preprocesses the graph into a contraction hierarchy, which
+        // takes a while but makes every hierarchyShortestPath query afterwards very fast, and
+        // hasContractionHierarchy returns true once it has been built for the edges as they are
+        void buildContractionHierarchy();
+        bool hasContractionHierarchy() const;
+
+        // hierarchyShortestPath returns the shortest distance from fromNode to toNode, or infinity if
+        // there is no path, and fills path with the nodes on the path, using the contraction hierarchy
+        // if it has been built and bidirectionalShortestPath otherwise
+        int hierarchyShortestPath(int fromNode, int toNode, vector<int>& path);
+
+        // getPath fills path with the nodes on the shortest path from fromNode to toNode, finding
+        // it with shortestDistance if needed, and returns its distance, or infinity with an empty
+        // path if there is no path, the second version also gives the data of each node on the path
+        int getPath(int fromNode, int toNode, vector<int>& path);
+        int getPath(int fromNode, int toNode, vector<int>& path, vector<const NodeData*>& pathData);
+
         // displayAll displays the shortest distance and the path 
-        // to all of the other nodes from each node
-        void displayAll();
+        // to all of the other nodes from each node, to cout unless another stream is given,
+        // the OutputBuffer version adds the text to a buffer that the caller writes out
+        void displayAll(ostream& output = cout);
+        void displayAll(OutputBuffer& output);
 
-        // display displays the shortest path between two given nodes in the graph
-        void display(int fromNode, int toNode);
+        // display displays the shortest path between two given nodes in the graph, computing
+        // it with shortestDistance if findShortestPath has not been called
+        void display(int fromNode, int toNode, ostream& output = cout);
+        void display(int fromNode, int toNode, OutputBuffer& output);
+
+        // getStats returns the counters and timings kept since the graph was created or resetStats
+        // was last called, they stay at 0 unless the program is compiled with GRAPH_STATS defined
+        const GraphStats& getStats() const;
+        void resetStats();
 
     private:
-        // The TableType struct is used to store all of the node information in the graph
-        struct TableType 
-        {
-            bool visited;                 
-            int dist;                       
-            int path;                       
-            NodeData nodeData;
-        };
-        
-        // The NodeData array used to represent the data of each node
-        NodeData data[GRAPHM_MAXNODES];     
+        // The NodeData array used to represent the data of each node (subscripts 1 to size)
+        vector<NodeData> data;
+
+        // Compressed sparse row graph holding the edge weights from each node, only edges that exist are stored
+        CsrGraph adjacency;
+
+        // The same edges reversed, so the edges of a node are the edges coming into it
+        CsrGraph reverseAdjacency;
 
-        // Adjacency matrix for all of the edge weights between each node       
-        int C[GRAPHM_MAXNODES][GRAPHM_MAXNODES];      
+        // Search spaces for the forward and backward halves of bidirectionalShortestPath,
+        // the forward one is also used by aStarShortestPath
+        SearchSpace forwardSearch;
+        SearchSpace backwardSearch;
 
         // Number of nodes in the graph 
         int size;
 
-        // 2D array used to store all of the node information (visited, shortest distance, path, and node data)
-        TableType T[GRAPHM_MAXNODES][GRAPHM_MAXNODES];   
+        // 2D table used to store the shortest distance, path and visited status of every node from
+        // each source node, a row is empty until Dijkstra's algorithm has been started from its source node
+        vector<TableRow> T;
+
+        // Set to 1 for each source node whose row of T has been computed for every node, a row
+        // that shortestDistance stopped early on only has correct entries for its visited nodes
+        vector<char> rowComplete;
+
+        // The landmark nodes picked by preprocessLandmarks
+        vector<int> landmarks;
+
+        // Shortest distances from each landmark to each node and from each node to each landmark,
+        // the distances for node n and landmark i are at subscript n * landmarks.size() + i so
+        // that all of the distances for one node are next to each other
+        vector<int> fromLandmark;
+        vector<int> toLandmark;
+
+        // Contraction hierarchy built by buildContractionHierarchy
+        ContractionHierarchy hierarchy;
+
+        // Heap used by shortestDistance and by the row repairs after an edge changes, kept so
+        // that each query does not allocate a new one
+        IndexedHeap<4> queryHeap;
+
+        // Engine used by findShortestPath
+        ShortestPathEngine engine;
+
+        // Number of edges with a weight of 0 or less, while there are any the computed rows of T
+        // are recomputed after an edge changes instead of being repaired
+        int nonPositiveEdges;
+
+        // Nodes whose distance changed during a row repair, and the mark of the nodes in the
+        // shortest path subtree that is being repaired
+        vector<int> repairNodes;
+        vector<char> repairMark;
 
-        // Recursive helper methods used to recursively display
-        // the data for all of the nodes between two nodes in the graph
-        // and the shortest path between those two nodes
-        void recursiveNodeDataHelper(int fromNode, int toNode);
-        void recursivePathHelper(int fromNode, int toNode);
+        // Counters of Dijkstra's algorithm and timings of the phases, see graphstats.h
+        GraphStats statistics;
+
+        // Helper method that runs Dijkstra's shortest path algorithm from one source node
+        void findShortestPathFromSource(int sourceNode, IndexedHeap<4>& heap, GraphStats& counters);
+
+        // Helper method that visits nodes from the source node in order of their shortest distance
+        // until targetNode has been visited, or until every reachable node has if targetNode is 0,
+        // the work done is counted in counters
+        void visitNodes(int sourceNode, int targetNode, IndexedHeap<4>& heap, GraphStats& counters);
+
+        // Helper method that resets the row of the source node to start Dijkstra's algorithm
+        void startRow(int sourceNode, IndexedHeap<4>& heap, GraphStats& counters);
+
+        // Helper methods that throw away all of the computed rows of T and the landmark distances,
+        // clearPreprocessing also throws away the contraction hierarchy after the edges change
+        void clearRows();
+        void clearLandmarks();
+        void clearPreprocessing();
+
+        // Helper method that brings the computed rows of T up to date after the weight of the edge
+        // from fromNode to toNode changed, NO_EDGE stands for an edge that does not exist
+        void updateRows(int fromNode, int toNode, long long oldWeight, long long newWeight, bool recompute);
+
+        // Helper methods that repair one row of T after the weight of an edge went down or up
+        void decreaseEdge(int sourceNode, int fromNode, int toNode, int newWeight);
+        void increaseEdge(int sourceNode, int fromNode, int toNode);
+
+        // Helper methods that pick the path entry of the nodes whose distance changed, and of the
+        // nodes that their edges lead to, the same way Dijkstra's algorithm would
+        void repairPaths(int sourceNode);
+        void choosePath(int sourceNode, int node);
+
+        // The EdgeChange struct is the net change updateEdges makes to one edge, NO_EDGE stands
+        // for an edge that does not exist
+        struct EdgeChange
+        {
+            int fromNode;
+            int toNode;
+            long long oldWeight;
+            long long newWeight;
+        };
+
+        // Helper methods for updateEdges that rebuild the edges with the changes made to them,
+        // and that check if a computed row of T can be changed by them
+        void applyEdgeChanges(const vector<EdgeChange>& changes);
+        bool rowAffected(int sourceNode, const vector<EdgeChange>& changes) const;
+
+        // Helper method that counts the edges with a weight of 0 or less
+        int countNonPositiveEdges() const;
+
+        // Helper method for the Floyd-Warshall engine, it fills in every row of T from the distance
+        // matrix and picks the path entries using threadCount threads
+        void findShortestPathFloydWarshall(int threadCount);
+
+        // Helper method that returns true if the Floyd-Warshall engine can be used on the graph
+        bool floydWarshallUsable() const;
+
+        // Helper method run by each thread of the parallel findShortestPath, it takes blocks of
+        // source nodes from nextSourceNode until all of the source nodes have been taken, denseGraph
+        // is the matrix of the dense engine or nullptr for the heap engine, the thread counts its
+        // work in counters
+        void findShortestPathWorker(atomic<int>& nextSourceNode, const DenseGraph* denseGraph, GraphStats& counters);
+
+        // Helper method for the A* searches, estimate is called with a node number and returns
+        // an estimate of the distance from that node to toNode
+        template <typename Estimate>
+        int aStarSearch(int fromNode, int toNode, vector<int>& path, Estimate estimate);
+
+        // Helper method that runs Dijkstra's algorithm over every reachable node of graph from
+        // the source node and stores the distances from the search in distances
+        void allDistancesFrom(const CsrGraph& graph, int sourceNode, SearchSpace& search, vector<int>& distances);
+
+        // Helper method that returns the landmark estimate of the distance from node to toNode
+        int landmarkEstimate(int node, int toNode) const;
+
+        // Helper method that fills path with the nodes on the path found by a search, following
+        // the previous nodes back from toNode
+        void searchPath(const SearchSpace& search, int toNode, vector<int>& path) const;
+
+        // Helper method that returns the shortest distance stored in T, or infinity
+        // if the shortest path from fromNode to toNode has not been found yet
+        int tableDistance(int fromNode, int toNode) const;
+
+        // Helper method that fills path with the nodes on the path stored in T and returns its
+        // distance, or infinity with an empty path if the path is not in T
+        int tablePath(int fromNode, int toNode, vector<int>& path) const;
         
 };
 
+// ------------------------------[aStarShortestPath]------------------------------------------
+// Description: The aStarShortestPath method for the GraphM class finds the shortest path from
+// the source node to the destination node with A* search, using a heuristic that looks at the
+// NodeData of a node and of the destination node. The heuristic is any functor like the ones
+// in heuristics.h, the search itself is done by aStarSearch.
+// -------------------------------------------------------------------------------------------
+template <typename Heuristic>
+int GraphM::aStarShortestPath(int fromNode, int toNode, vector<int>& path, Heuristic heuristic)
+{
+    path.clear();
+
+    // If the source node or destination node are not within the bounds of the graph, there is no path
+    if (fromNode > size || fromNode < 1 || toNode > size || toNode < 1)
+    {
+        return INT_MAX;
+    }
+
+    // The estimate for each node compares its data with the data of the destination node
+    return aStarSearch(fromNode, toNode, path, [&](int node) { return heuristic(data[node], data[toNode]); });
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[aStarSearch]----------------------------------------------
+// Description: The aStarSearch method for the GraphM class finds the shortest path from the
+// source node to the destination node with A* search. It works like Dijkstra's algorithm,
+// but the next node visited is the one with the smallest distance from the source node plus
+// the estimate of its distance to the destination node, so the search heads towards the
+// destination node and visits far fewer nodes. The search stops when the destination node
+// is visited. As long as the estimate is never more than the real distance the path found
+// is a shortest path, a node that is found to be closer after it was visited is visited
+// again. The estimate is a callable that is given a node number.
+// -------------------------------------------------------------------------------------------
+template <typename Estimate>
+int GraphM::aStarSearch(int fromNode, int toNode, vector<int>& path, Estimate estimate)
+{
+    // The search starts from the source node at a distance of 0
+    forwardSearch.clear();
+    forwardSearch.relax(fromNode, 0, 0, WeightTraits<int>::extend(0, estimate(fromNode)));
+
+    while (!forwardSearch.empty())
+    {
+        // The node with the smallest distance plus estimate is visited next,
+        // once it is the destination node its distance is the shortest distance
+        int currentNode = forwardSearch.visitNext();
+
+        if (currentNode == toNode)
+        {
+            searchPath(forwardSearch, toNode, path);
+            return forwardSearch.distance(toNode);
+        }
+
+        // The distances of the nodes adjacent to the current node are updated, with the estimate
+        // of their distance to the destination node added to their place in the heap, the sum
+        // saturates so a distance close to INT_MAX can not wrap around to a small key
+        for (int edge = adjacency.beginEdge(currentNode); edge < adjacency.endEdge(currentNode); edge++)
+        {
+            int adjacentNode = adjacency.edgeTarget(edge);
+            int newDistance = WeightTraits<int>::extend(forwardSearch.distance(currentNode), adjacency.edgeWeight(edge));
+
+            if (newDistance < forwardSearch.distance(adjacentNode))
+            {
+                forwardSearch.relax(adjacentNode, newDistance, currentNode, WeightTraits<int>::extend(newDistance, estimate(adjacentNode)));
+            }
+        }
+    }
+
+    // The destination node could not be reached
+    return INT_MAX;
+}
+// -------------------------------------------------------------------------------------------
+
 #endif
@@ -0,0 +1,264 @@
+// -------------------------- graphpipeline.cpp ------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphpipeline.cpp file is the implementation file for the
+// GraphPipeline class. It contains the run method, which starts the reader
+// and worker threads and writes the output, and the helper methods run by
+// the reader thread and the worker threads.
+// ---------------------------------------------------------------------
+// Notes - All of the shared state is guarded by one mutex. Reading a graph,
+// processing it and writing its output are done without holding the lock,
+// it is only held while a graph or its output is handed from one stage to
+// the next. The reader waits while the limit of graphs is reached, the
+// workers wait for a graph to process and the writer waits for the output
+// of the next graph in order. No exception is let out of a thread, since
+// that would end the program: a worker hands the exception of its task to
+// the writer in place of the graph's output, and the reader keeps the
+// exception of the loader until the graphs read before it are written.
+// ---------------------------------------------------------------------
+#include "graphpipeline.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+using namespace std;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The GraphPipeline constructor sets the number of worker threads and the
+// largest number of graphs that can be read in but not written yet. A worker count of 0
+// uses one worker for each core, and a graph limit of 0 uses four graphs for each worker.
+// -------------------------------------------------------------------------------------------
+GraphPipeline::GraphPipeline(int workerCount, int graphLimit)
+{
+    // A worker count of 0 uses the number of cores, if it is unknown a single worker is used
+    if (workerCount <= 0)
+    {
+        workerCount = static_cast<int>(thread::hardware_concurrency());
+    }
+
+    workers = workerCount > 0 ? workerCount : 1;
+    maximumGraphs = graphLimit > 0 ? graphLimit : 4 * workers;
+    graphsRead = 0;
+    graphsWritten = 0;
+    readingDone = false;
+    stopping = false;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------------[run]------------------------------------------------
+// Description: The run method starts the reader thread and the worker threads, then writes
+// the output of each graph to the output stream as soon as the output of every graph before
+// it has been written. It returns once every graph has been read, processed and written. If
+// a task or the output stream throws, the writer stops at that graph and tells the other
+// threads to stop, and once they are joined the exception is thrown again. An exception of
+// the loader is thrown again after the graphs read before it have been written.
+// -------------------------------------------------------------------------------------------
+void GraphPipeline::run(GraphLoader& loader, bool weighted, const GraphTask& task, ostream& output)
+{
+    waitingGraphs.clear();
+    finishedOutput.clear();
+    graphsRead = 0;
+    graphsWritten = 0;
+    readingDone = false;
+    stopping = false;
+    readError = nullptr;
+    exception_ptr error;
+
+    thread reader(&GraphPipeline::readGraphs, this, ref(loader), weighted);
+    vector<thread> workerThreads;
+
+    for (int worker = 0; worker < workers; worker++)
+    {
+        workerThreads.push_back(thread(&GraphPipeline::processGraphs, this, cref(task)));
+    }
+
+    // The writer stage runs on the calling thread and writes the output in input order
+    while (true)
+    {
+        GraphResult result;
+
+        {
+            unique_lock<mutex> lock(stateLock);
+
+            // Wait until the next graph's output is ready, or every graph has been written
+            outputFinished.wait(lock, [this]
+            {
+                return finishedOutput.count(graphsWritten) > 0 || (readingDone && graphsWritten == graphsRead);
+            });
+
+            if (finishedOutput.count(graphsWritten) == 0)
+            {
+                break;
+            }
+
+            result = move(finishedOutput[graphsWritten]);
+            finishedOutput.erase(graphsWritten);
+            graphsWritten++;
+        }
+
+        // A graph has left the pipeline, so the reader can read another one
+        roomForGraph.notify_one();
+
+        if (result.error)
+        {
+            error = result.error;
+            break;
+        }
+
+        try
+        {
+            output << result.output;
+        }
+        catch (...)
+        {
+            error = current_exception();
+            break;
+        }
+    }
+
+    // If the writer stopped early, the reader and the workers stop before their next graph
+    if (error)
+    {
+        {
+            lock_guard<mutex> lock(stateLock);
+            stopping = true;
+        }
+
+        roomForGraph.notify_all();
+        graphWaiting.notify_all();
+    }
+
+    reader.join();
+
+    for (thread& workerThread : workerThreads)
+    {
+        workerThread.join();
+    }
+
+    if (!error)
+    {
+        error = readError;
+    }
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[readGraphs]---------------------------------------------
+// Description: The readGraphs method is run by the reader thread. It reads graphs from the
+// loader and hands them to the workers until the loader reaches the end of the file, waiting
+// whenever the limit of graphs that have been read but not written is reached. It stops
+// early if the writer is stopping, and if the loader throws, the exception is kept for run.
+// -------------------------------------------------------------------------------------------
+void GraphPipeline::readGraphs(GraphLoader& loader, bool weighted)
+{
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(stateLock);
+            roomForGraph.wait(lock, [this] { return graphsRead - graphsWritten < maximumGraphs || stopping; });
+
+            if (stopping)
+            {
+                break;
+            }
+        }
+
+        // The graph is read without holding the lock
+        GraphJob job;
+
+        try
+        {
+            loader.readGraph(job.graph, weighted);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(stateLock);
+            readError = current_exception();
+            break;
+        }
+
+        // The graph read when the end of the file is reached is not processed, like in lab3
+        if (loader.eof())
+        {
+            break;
+        }
+
+        {
+            lock_guard<mutex> lock(stateLock);
+            job.sequence = graphsRead++;
+            waitingGraphs.push_back(move(job));
+        }
+
+        graphWaiting.notify_one();
+    }
+
+    {
+        lock_guard<mutex> lock(stateLock);
+        readingDone = true;
+    }
+
+    // The workers and the writer are woken up so they can see that reading is done
+    graphWaiting.notify_all();
+    outputFinished.notify_all();
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[processGraphs]-------------------------------------------
+// Description: The processGraphs method is run by each worker thread. It takes the next
+// graph that has been read in, runs the task on it with a string stream as its output and
+// hands the output to the writer, until reading is done and no graphs are left or the writer
+// is stopping. If the task throws, the exception is handed to the writer instead.
+// -------------------------------------------------------------------------------------------
+void GraphPipeline::processGraphs(const GraphTask& task)
+{
+    while (true)
+    {
+        GraphJob job;
+
+        {
+            unique_lock<mutex> lock(stateLock);
+            graphWaiting.wait(lock, [this] { return !waitingGraphs.empty() || readingDone || stopping; });
+
+            if (waitingGraphs.empty() || stopping)
+            {
+                return;
+            }
+
+            job = move(waitingGraphs.front());
+            waitingGraphs.pop_front();
+        }
+
+        // The graph is processed without holding the lock
+        GraphResult result;
+
+        try
+        {
+            ostringstream graphOutput;
+            task(job.graph, graphOutput);
+            result.output = graphOutput.str();
+        }
+        catch (...)
+        {
+            result.error = current_exception();
+        }
+
+        {
+            lock_guard<mutex> lock(stateLock);
+            finishedOutput[job.sequence] = move(result);
+        }
+
+        outputFinished.notify_one();
+    }
+}
+// -------------------------------------------------------------------------------------------
@@ -0,0 +1,106 @@
+// --------------------------- graphpipeline.h -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphpipeline.h file is the header file for the
+// GraphPipeline class, which processes every graph in an input data text
+// file in three overlapping stages: a reader thread reads the next graphs
+// with a GraphLoader, worker threads build and process the graphs that
+// have been read, and the calling thread writes the output of each graph
+// in the order the graphs appear in the file. lab3 uses it to run
+// Dijkstra's algorithm and the depth-first search on its data files.
+// ---------------------------------------------------------------------
+// Notes - The work done for each graph is a GraphTask, which is given the
+// graph that was read in and a stream to write its output to. Each graph's
+// output is written to its own string stream and only copied to the output
+// stream when every graph before it has been written, so the output is the
+// same as processing the graphs one after another. The number of graphs
+// that have been read but not written yet is limited, so a file with any
+// number of graphs is processed in a bounded amount of memory. Like the
+// lab3 loop, reading stops at the first graph after which the loader has
+// reached the end of the file, and that graph is not processed. An
+// exception thrown by a task, by the loader or by the output stream stops
+// the pipeline: the output of the graphs before the failed one is still
+// written, the threads are joined and the exception is thrown again by
+// run on the calling thread.
+// ---------------------------------------------------------------------
+#ifndef GRAPH_PIPELINE_H
+#define GRAPH_PIPELINE_H
+#include "graphloader.h"
+#include <iostream>
+#include <string>
+#include <deque>
+#include <map>
+#include <functional>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
+using namespace std;
+
+class GraphPipeline {
+
+    public:
+        // A GraphTask builds and processes one graph and writes its output to the given stream
+        typedef function<void(const GraphText& graph, ostream& output)> GraphTask;
+
+        // GraphPipeline constructor sets the number of worker threads, 0 uses one for each core,
+        // and the largest number of graphs that can be read but not written yet, 0 uses four
+        // for each worker thread
+        explicit GraphPipeline(int workerCount = 0, int graphLimit = 0);
+
+        // run reads every graph from the loader, weighted graphs are read like GraphM and
+        // unweighted graphs like GraphL, runs the task on each of them and writes their
+        // output to the output stream in the order they were read in, an exception thrown while
+        // a graph is read, processed or written is thrown again once the threads have stopped
+        void run(GraphLoader& loader, bool weighted, const GraphTask& task, ostream& output);
+
+    private:
+        // The GraphJob struct is a graph that has been read in and its position in the file
+        struct GraphJob
+        {
+            long sequence;
+            GraphText graph;
+        };
+
+        // The GraphResult struct is the output of a processed graph, or the exception its task
+        // threw instead
+        struct GraphResult
+        {
+            string output;
+            exception_ptr error;
+        };
+
+        // Number of worker threads and the largest number of graphs read but not written
+        int workers;
+        int maximumGraphs;
+
+        // Graphs read in that no worker has taken yet
+        deque<GraphJob> waitingGraphs;
+
+        // Output of the graphs that have been processed but not written yet, by position
+        map<long, GraphResult> finishedOutput;
+
+        // Number of graphs read in, number of graphs written, set once the reader is done, and
+        // set when the writer stops early because of an exception
+        long graphsRead;
+        long graphsWritten;
+        bool readingDone;
+        bool stopping;
+
+        // Exception thrown by the loader, the graphs read before it are still processed
+        exception_ptr readError;
+
+        // Lock for the members above, and the conditions the stages wait on
+        mutex stateLock;
+        condition_variable graphWaiting;
+        condition_variable outputFinished;
+        condition_variable roomForGraph;
+
+        // Helper methods run by the reader thread and by each worker thread
+        void readGraphs(GraphLoader& loader, bool weighted);
+        void processGraphs(const GraphTask& task);
+};
+
+#endif
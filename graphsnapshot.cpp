@@ -0,0 +1,551 @@
+// -------------------------- graphsnapshot.cpp ------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphsnapshot.cpp file is the implementation file for the
+// GraphSnapshot class. It contains the method that writes a snapshot
+// file, the method that maps one and checks it, and the accessor methods
+// that point into the mapped sections.
+// ---------------------------------------------------------------------
+// Notes - Opening a snapshot does not copy the sections, it only checks
+// them: the section offsets and sizes must match the counts in the header,
+// the CSR offsets must be in order and every target node, source node and
+// path entry must be a node of the graph. These checks read each array
+// once, which is much less work than parsing the text file and running
+// Dijkstra's algorithm again.
+// ---------------------------------------------------------------------
+#include "graphsnapshot.h"
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+using namespace std;
+
+// Tag at the start of a snapshot file ("GSNP") and the version of the format, version 1 had
+// no byte order word
+const uint32_t SNAPSHOT_FILE_TAG = 0x504E5347;
+const uint32_t SNAPSHOT_VERSION = 2;
+
+// Byte order word of the header, it reads as 0x04030201 on a machine with the other byte order
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+// Every section starts at a multiple of this many bytes
+const uint64_t SECTION_ALIGNMENT = 8;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The GraphSnapshot constructor creates a snapshot with no file open.
+// -------------------------------------------------------------------------------------------
+GraphSnapshot::GraphSnapshot()
+{
+    mapping = nullptr;
+    mappingLength = 0;
+    header = nullptr;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Destructor]----------------------------------------------
+// Description: The GraphSnapshot destructor unmaps the file.
+// -------------------------------------------------------------------------------------------
+GraphSnapshot::~GraphSnapshot()
+{
+    close();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[write]-----------------------------------------------
+// Description: The write method writes the contents to a snapshot file. The size of every
+// section is worked out first so that the header can be written with the offset of each
+// section, then the sections are written in order with padding between them. The sections
+// are written to a temporary file next to the snapshot, which is renamed over it once it is
+// complete, so a graph whose edges are mapped from the old file can be saved back to it and
+// a failed write leaves the old file as it was. The temporary file is flushed to the disk
+// before the rename and the directory after it, otherwise a crash right after the rename
+// could leave an empty file under the snapshot's name. A graph whose rows have unused slots
+// left by changed edges is compacted into a copy first, since the sections hold the CSR
+// arrays as they are. It returns false if the file could not be written.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::write(const string& fileName, const SnapshotContents& contents)
+{
+    CsrGraph compactEdges;
+    CsrGraph compactReverseEdges;
+    const CsrGraph* forwardEdges = contents.edges;
+    const CsrGraph* reverseEdges = contents.reverseEdges;
+
+    if (!forwardEdges->isCompact())
+    {
+        compactEdges = *forwardEdges;
+        compactEdges.compact();
+        forwardEdges = &compactEdges;
+    }
+
+    if (reverseEdges != nullptr && !reverseEdges->isCompact())
+    {
+        compactReverseEdges = *reverseEdges;
+        compactReverseEdges.compact();
+        reverseEdges = &compactReverseEdges;
+    }
+
+    const CsrGraph& edges = *forwardEdges;
+    int nodes = edges.nodeCount();
+    int rows = static_cast<int>(contents.rowSources.size());
+
+    // The descriptions are stored one after the other, node n's description runs from
+    // descriptionOffsets[n - 1] up to descriptionOffsets[n]
+    vector<uint64_t> descriptionOffsets(nodes + 1, 0);
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        descriptionOffsets[node] = descriptionOffsets[node - 1] + contents.descriptions[node - 1].size();
+    }
+
+    // The header records the counts and where each section starts
+    SnapshotHeader fileHeader;
+    memset(&fileHeader, 0, sizeof(fileHeader));
+    fileHeader.tag = SNAPSHOT_FILE_TAG;
+    fileHeader.version = SNAPSHOT_VERSION;
+    fileHeader.graphKind = contents.graphKind;
+    fileHeader.nodeCount = nodes;
+    fileHeader.edgeCount = edges.edgeCount();
+    fileHeader.reverseEdgeCount = reverseEdges != nullptr ? reverseEdges->edgeCount() : -1;
+    fileHeader.rowCount = rows;
+    fileHeader.byteOrder = SNAPSHOT_BYTE_ORDER;
+
+    const void* sectionData[SECTION_COUNT] = {};
+    sectionData[DESCRIPTION_OFFSETS] = descriptionOffsets.data();
+    fileHeader.sectionSize[DESCRIPTION_OFFSETS] = descriptionOffsets.size() * sizeof(uint64_t);
+    fileHeader.sectionSize[DESCRIPTION_CHARACTERS] = descriptionOffsets[nodes];
+    sectionData[EDGE_OFFSETS] = edges.offsetData();
+    fileHeader.sectionSize[EDGE_OFFSETS] = (uint64_t(nodes) + 2) * sizeof(int);
+    sectionData[EDGE_TARGETS] = edges.targetData();
+    fileHeader.sectionSize[EDGE_TARGETS] = uint64_t(edges.edgeCount()) * sizeof(int);
+    sectionData[EDGE_WEIGHTS] = edges.weightData();
+    fileHeader.sectionSize[EDGE_WEIGHTS] = uint64_t(edges.edgeCount()) * sizeof(int);
+
+    if (reverseEdges != nullptr)
+    {
+        sectionData[REVERSE_OFFSETS] = reverseEdges->offsetData();
+        fileHeader.sectionSize[REVERSE_OFFSETS] = (uint64_t(nodes) + 2) * sizeof(int);
+        sectionData[REVERSE_TARGETS] = reverseEdges->targetData();
+        fileHeader.sectionSize[REVERSE_TARGETS] = uint64_t(reverseEdges->edgeCount()) * sizeof(int);
+        sectionData[REVERSE_WEIGHTS] = reverseEdges->weightData();
+        fileHeader.sectionSize[REVERSE_WEIGHTS] = uint64_t(reverseEdges->edgeCount()) * sizeof(int);
+    }
+
+    sectionData[ROW_SOURCES] = contents.rowSources.data();
+    fileHeader.sectionSize[ROW_SOURCES] = uint64_t(rows) * sizeof(int);
+    sectionData[ROW_DISTANCES] = contents.rowDistances.data();
+    fileHeader.sectionSize[ROW_DISTANCES] = uint64_t(rows) * (nodes + 1) * sizeof(int);
+    sectionData[ROW_PATHS] = contents.rowPaths.data();
+    fileHeader.sectionSize[ROW_PATHS] = uint64_t(rows) * (nodes + 1) * sizeof(int);
+
+    // Each section starts at the next multiple of the alignment after the one before it
+    uint64_t position = sizeof(SnapshotHeader);
+
+    for (int which = 0; which < SECTION_COUNT; which++)
+    {
+        position = (position + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+        fileHeader.sectionOffset[which] = position;
+        position += fileHeader.sectionSize[which];
+    }
+
+    fileHeader.fileSize = position;
+
+    string temporaryName = fileName + ".tmp";
+    ofstream outputfile(temporaryName, ios::binary);
+
+    if (!outputfile)
+    {
+        return false;
+    }
+
+    outputfile.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+    position = sizeof(SnapshotHeader);
+
+    for (int which = 0; which < SECTION_COUNT; which++)
+    {
+        // Zero bytes are written up to the start of the section
+        const char padding[SECTION_ALIGNMENT] = {};
+        outputfile.write(padding, fileHeader.sectionOffset[which] - position);
+        position = fileHeader.sectionOffset[which] + fileHeader.sectionSize[which];
+
+        // The descriptions are written one at a time, the other sections are written as they are in memory
+        if (which == DESCRIPTION_CHARACTERS)
+        {
+            for (const string& text : contents.descriptions)
+            {
+                outputfile.write(text.data(), text.size());
+            }
+        }
+        else if (fileHeader.sectionSize[which] > 0)
+        {
+            outputfile.write(static_cast<const char*>(sectionData[which]), fileHeader.sectionSize[which]);
+        }
+    }
+
+    // The finished file is flushed to the disk and replaces the snapshot, the old file stays
+    // mapped until it is closed
+    outputfile.close();
+
+    if (!outputfile || !syncToDisk(temporaryName) || rename(temporaryName.c_str(), fileName.c_str()) != 0)
+    {
+        remove(temporaryName.c_str());
+        return false;
+    }
+
+    // The rename itself is made lasting by flushing the directory that holds the snapshot
+    size_t lastSlash = fileName.find_last_of('/');
+    string directory = lastSlash == string::npos ? "." : (lastSlash == 0 ? "/" : fileName.substr(0, lastSlash));
+    return syncToDisk(directory);
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[open]------------------------------------------------
+// Description: The open method maps a snapshot file and checks that it is a valid snapshot.
+// It returns false, and leaves the snapshot with no file open, if the file can not be mapped
+// or any of the checks fail.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::open(const string& fileName)
+{
+    close();
+
+    int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStatus;
+
+    if (fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode) ||
+        static_cast<uint64_t>(fileStatus.st_size) < sizeof(SnapshotHeader))
+    {
+        ::close(fileDescriptor);
+        return false;
+    }
+
+    void* address = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    ::close(fileDescriptor);
+
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mapping = address;
+    mappingLength = fileStatus.st_size;
+    header = static_cast<const SnapshotHeader*>(address);
+
+    // The header is checked before any section is read
+    if (!validHeader())
+    {
+        close();
+        return false;
+    }
+
+    bool valid = validEdges(edgeOffsets(), edgeTargets(), header->edgeCount) &&
+                 (!hasReverseEdges() || validEdges(reverseOffsets(), reverseTargets(), header->reverseEdgeCount)) &&
+                 validRows();
+
+    if (!valid)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[graphKind]---------------------------------------------
+// Description: The graphKind method returns the kind of graph stored in the snapshot.
+// -------------------------------------------------------------------------------------------
+int GraphSnapshot::graphKind() const
+{
+    return header->graphKind;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[nodeCount]---------------------------------------------
+// Description: The nodeCount method returns the number of nodes in the graph.
+// -------------------------------------------------------------------------------------------
+int GraphSnapshot::nodeCount() const
+{
+    return header->nodeCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[edgeCount]---------------------------------------------
+// Description: The edgeCount method returns the number of edges in the graph.
+// -------------------------------------------------------------------------------------------
+int GraphSnapshot::edgeCount() const
+{
+    return header->edgeCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[hasReverseEdges]------------------------------------------
+// Description: The hasReverseEdges method returns true if the reversed edges were saved.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::hasReverseEdges() const
+{
+    return header->reverseEdgeCount >= 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[rowCount]---------------------------------------------
+// Description: The rowCount method returns the number of rows of T that were saved.
+// -------------------------------------------------------------------------------------------
+int GraphSnapshot::rowCount() const
+{
+    return header->rowCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[description]--------------------------------------------
+// Description: The description method returns the description of the node, it is copied
+// out of the mapped file.
+// -------------------------------------------------------------------------------------------
+string GraphSnapshot::description(int node) const
+{
+    const uint64_t* offsets = reinterpret_cast<const uint64_t*>(section(DESCRIPTION_OFFSETS));
+    const char* characters = section(DESCRIPTION_CHARACTERS);
+    return string(characters + offsets[node - 1], characters + offsets[node]);
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[edgeOffsets and others]-------------------------------------
+// Description: The edgeOffsets, edgeTargets and edgeWeights methods return the CSR arrays of
+// the edges and the reverse methods return the CSR arrays of the reversed edges.
+// -------------------------------------------------------------------------------------------
+const int* GraphSnapshot::edgeOffsets() const
+{
+    return reinterpret_cast<const int*>(section(EDGE_OFFSETS));
+}
+
+const int* GraphSnapshot::edgeTargets() const
+{
+    return reinterpret_cast<const int*>(section(EDGE_TARGETS));
+}
+
+const int* GraphSnapshot::edgeWeights() const
+{
+    return reinterpret_cast<const int*>(section(EDGE_WEIGHTS));
+}
+
+const int* GraphSnapshot::reverseOffsets() const
+{
+    return reinterpret_cast<const int*>(section(REVERSE_OFFSETS));
+}
+
+const int* GraphSnapshot::reverseTargets() const
+{
+    return reinterpret_cast<const int*>(section(REVERSE_TARGETS));
+}
+
+const int* GraphSnapshot::reverseWeights() const
+{
+    return reinterpret_cast<const int*>(section(REVERSE_WEIGHTS));
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[rowSource and others]--------------------------------------
+// Description: The rowSource method returns the source node of a saved row of T, and the
+// rowDistances and rowPaths methods return the distance and path of every node in that row.
+// -------------------------------------------------------------------------------------------
+int GraphSnapshot::rowSource(int row) const
+{
+    return reinterpret_cast<const int*>(section(ROW_SOURCES))[row];
+}
+
+const int* GraphSnapshot::rowDistances(int row) const
+{
+    return reinterpret_cast<const int*>(section(ROW_DISTANCES)) + size_t(row) * (header->nodeCount + 1);
+}
+
+const int* GraphSnapshot::rowPaths(int row) const
+{
+    return reinterpret_cast<const int*>(section(ROW_PATHS)) + size_t(row) * (header->nodeCount + 1);
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[section]----------------------------------------------
+// Description: The section method returns a pointer to the start of a section in the
+// mapped file.
+// -------------------------------------------------------------------------------------------
+const char* GraphSnapshot::section(Section which) const
+{
+    return static_cast<const char*>(mapping) + header->sectionOffset[which];
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[validHeader]--------------------------------------------
+// Description: The validHeader method checks the byte order, tag, version and counts in the
+// header, and that every section has the size the counts call for, starts on an aligned
+// offset and lies inside the file. The reversed edges must be as many as the edges, since they are the same
+// edges, and the graphs view both with the same count. The description offsets are checked
+// here as well since the size of the description characters section depends on them.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::validHeader() const
+{
+    if (header->byteOrder != SNAPSHOT_BYTE_ORDER || header->tag != SNAPSHOT_FILE_TAG ||
+        header->version != SNAPSHOT_VERSION || header->fileSize != mappingLength ||
+        header->nodeCount < 0 || header->edgeCount < 0 ||
+        (header->reverseEdgeCount != -1 && header->reverseEdgeCount != header->edgeCount) ||
+        header->rowCount < 0 || header->rowCount > header->nodeCount ||
+        (header->graphKind != WEIGHTED_GRAPH && header->graphKind != UNWEIGHTED_GRAPH))
+    {
+        return false;
+    }
+
+    // The size every section must have, the description characters are checked below
+    uint64_t nodes = header->nodeCount;
+    uint64_t edges = header->edgeCount;
+    uint64_t rows = header->rowCount;
+    bool reverse = hasReverseEdges();
+    uint64_t reverseEdges = reverse ? header->reverseEdgeCount : 0;
+    uint64_t expectedSize[SECTION_COUNT];
+    expectedSize[DESCRIPTION_OFFSETS] = (nodes + 1) * sizeof(uint64_t);
+    expectedSize[DESCRIPTION_CHARACTERS] = header->sectionSize[DESCRIPTION_CHARACTERS];
+    expectedSize[EDGE_OFFSETS] = (nodes + 2) * sizeof(int);
+    expectedSize[EDGE_TARGETS] = edges * sizeof(int);
+    expectedSize[EDGE_WEIGHTS] = edges * sizeof(int);
+    expectedSize[REVERSE_OFFSETS] = reverse ? (nodes + 2) * sizeof(int) : 0;
+    expectedSize[REVERSE_TARGETS] = reverseEdges * sizeof(int);
+    expectedSize[REVERSE_WEIGHTS] = reverseEdges * sizeof(int);
+    expectedSize[ROW_SOURCES] = rows * sizeof(int);
+    expectedSize[ROW_DISTANCES] = rows * (nodes + 1) * sizeof(int);
+    expectedSize[ROW_PATHS] = rows * (nodes + 1) * sizeof(int);
+
+    for (int which = 0; which < SECTION_COUNT; which++)
+    {
+        uint64_t offset = header->sectionOffset[which];
+
+        if (header->sectionSize[which] != expectedSize[which] || offset % SECTION_ALIGNMENT != 0 ||
+            offset < sizeof(SnapshotHeader) || offset > mappingLength ||
+            expectedSize[which] > mappingLength - offset)
+        {
+            return false;
+        }
+    }
+
+    // The description offsets must be in order and end at the size of the characters section
+    const uint64_t* descriptionOffsets = reinterpret_cast<const uint64_t*>(section(DESCRIPTION_OFFSETS));
+
+    if (descriptionOffsets[0] != 0 || descriptionOffsets[nodes] != header->sectionSize[DESCRIPTION_CHARACTERS])
+    {
+        return false;
+    }
+
+    for (uint64_t node = 1; node <= nodes; node++)
+    {
+        if (descriptionOffsets[node] < descriptionOffsets[node - 1])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[validEdges]---------------------------------------------
+// Description: The validEdges method checks CSR arrays: row 0 must be empty, the offsets must
+// never go down and must end at the number of edges, and every target must be a node.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::validEdges(const int* offsets, const int* targets, int edges) const
+{
+    int nodes = header->nodeCount;
+
+    if (offsets[0] != 0 || offsets[1] != 0 || offsets[nodes + 1] != edges)
+    {
+        return false;
+    }
+
+    for (int node = 1; node <= nodes + 1; node++)
+    {
+        if (offsets[node] < offsets[node - 1])
+        {
+            return false;
+        }
+    }
+
+    for (int edge = 0; edge < edges; edge++)
+    {
+        if (targets[edge] < 1 || targets[edge] > nodes)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[validRows]---------------------------------------------
+// Description: The validRows method checks that every saved row has a source node of the
+// graph and that every path entry is 0 or a node of the graph.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::validRows() const
+{
+    int nodes = header->nodeCount;
+
+    for (int row = 0; row < header->rowCount; row++)
+    {
+        if (rowSource(row) < 1 || rowSource(row) > nodes)
+        {
+            return false;
+        }
+
+        const int* paths = rowPaths(row);
+
+        for (int node = 0; node <= nodes; node++)
+        {
+            if (paths[node] < 0 || paths[node] > nodes)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[close]-----------------------------------------------
+// Description: The close method unmaps the file, if one is open.
+// -------------------------------------------------------------------------------------------
+void GraphSnapshot::close()
+{
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappingLength);
+    }
+
+    mapping = nullptr;
+    mappingLength = 0;
+    header = nullptr;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[syncToDisk]---------------------------------------------
+// Description: The syncToDisk method opens a file or a directory and waits until everything
+// written to it is on the disk. It returns false if it could not be opened or flushed.
+// -------------------------------------------------------------------------------------------
+bool GraphSnapshot::syncToDisk(const string& path)
+{
+    int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    bool synced = fsync(fileDescriptor) == 0;
+    ::close(fileDescriptor);
+    return synced;
+}
+// -------------------------------------------------------------------------------------------
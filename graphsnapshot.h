@@ -0,0 +1,159 @@
+// --------------------------- graphsnapshot.h -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphsnapshot.h file is the header file for the
+// GraphSnapshot class, which writes a graph to a binary snapshot file and
+// memory maps it back in. GraphM and GraphL use it in their saveSnapshot
+// and loadSnapshot methods, so a large graph can be loaded without reading
+// the text file again, and GraphM can also skip findShortestPath for the
+// rows of T that were saved.
+// ---------------------------------------------------------------------
+// Notes - The file starts with a SnapshotHeader that has a tag, a version
+// number, the counts of the graph and the byte offset of every section.
+// The sections are the node descriptions, the CSR arrays of the edges, the
+// CSR arrays of the reversed edges (optional) and the distance and path
+// arrays of the saved rows of T (optional), each starting at a multiple of
+// 8 bytes. Loading a snapshot maps the file and points at the sections,
+// the CSR arrays are used in place through CsrGraph::view. The numbers
+// are stored in the byte order of the machine that wrote the file, and
+// the header has a byte order word, so a file from a machine with the
+// other byte order is rejected instead of being mapped as garbage. The
+// snapshot is checked when it is opened, so a damaged file is rejected
+// instead of leading to subscripts outside of the graph. A snapshot is
+// written to a temporary file that is flushed to the disk and renamed
+// over the old file, so a crash leaves either the old or the new file.
+// ---------------------------------------------------------------------
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+#include "csrgraph.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+using namespace std;
+
+// The SnapshotContents struct holds what saveSnapshot writes to a snapshot file
+struct SnapshotContents
+{
+    // Kind of graph class the snapshot is for, one of the GraphSnapshot graph kinds
+    int graphKind;
+
+    // Descriptions of the nodes from 1 to the number of nodes, stored from subscript 0
+    vector<string> descriptions;
+
+    // Edges of the graph and the reversed edges, reverseEdges can be nullptr
+    const CsrGraph* edges;
+    const CsrGraph* reverseEdges;
+
+    // Source node of each saved row of T, and the distance and path of every node in those
+    // rows, stored one row after the other with nodeCount + 1 entries for each row
+    vector<int> rowSources;
+    vector<int> rowDistances;
+    vector<int> rowPaths;
+};
+
+class GraphSnapshot {
+
+    public:
+        // Kinds of graph a snapshot can hold, a weighted graph for GraphM and an unweighted
+        // graph that keeps repeated edges for GraphL
+        static const int WEIGHTED_GRAPH = 1;
+        static const int UNWEIGHTED_GRAPH = 2;
+
+        // GraphSnapshot constructor creates a snapshot with no file open, the destructor unmaps the file
+        GraphSnapshot();
+        ~GraphSnapshot();
+
+        // The snapshot owns the mapping of its file so it can not be copied
+        GraphSnapshot(const GraphSnapshot&) = delete;
+        GraphSnapshot& operator=(const GraphSnapshot&) = delete;
+
+        // write writes the contents to a snapshot file and returns false if it could not be written
+        static bool write(const string& fileName, const SnapshotContents& contents);
+
+        // open maps a snapshot file and returns false if it can not be read or is not a valid snapshot
+        bool open(const string& fileName);
+
+        // Methods for getting the counts stored in the snapshot
+        int graphKind() const;
+        int nodeCount() const;
+        int edgeCount() const;
+        bool hasReverseEdges() const;
+        int rowCount() const;
+
+        // description returns the description of a node
+        string description(int node) const;
+
+        // Methods for getting the CSR arrays of the edges and the reversed edges, laid out
+        // like the arrays of a CsrGraph
+        const int* edgeOffsets() const;
+        const int* edgeTargets() const;
+        const int* edgeWeights() const;
+        const int* reverseOffsets() const;
+        const int* reverseTargets() const;
+        const int* reverseWeights() const;
+
+        // Methods for getting the source node and the distance and path arrays of a saved row,
+        // the arrays have nodeCount + 1 entries
+        int rowSource(int row) const;
+        const int* rowDistances(int row) const;
+        const int* rowPaths(int row) const;
+
+    private:
+        // Sections of the file, in the order they are written
+        enum Section
+        {
+            DESCRIPTION_OFFSETS,
+            DESCRIPTION_CHARACTERS,
+            EDGE_OFFSETS,
+            EDGE_TARGETS,
+            EDGE_WEIGHTS,
+            REVERSE_OFFSETS,
+            REVERSE_TARGETS,
+            REVERSE_WEIGHTS,
+            ROW_SOURCES,
+            ROW_DISTANCES,
+            ROW_PATHS,
+            SECTION_COUNT
+        };
+
+        // The SnapshotHeader struct is stored at the start of the file
+        struct SnapshotHeader
+        {
+            uint32_t tag;
+            uint32_t version;
+            int32_t graphKind;
+            int32_t nodeCount;
+            int32_t edgeCount;
+            int32_t reverseEdgeCount;
+            int32_t rowCount;
+            uint32_t byteOrder;
+            uint64_t fileSize;
+            uint64_t sectionOffset[SECTION_COUNT];
+            uint64_t sectionSize[SECTION_COUNT];
+        };
+
+        // The mapped file and its header
+        void* mapping;
+        size_t mappingLength;
+        const SnapshotHeader* header;
+
+        // Helper method that returns a pointer to the start of a section
+        const char* section(Section which) const;
+
+        // Helper methods that check the contents of a mapped file
+        bool validHeader() const;
+        bool validEdges(const int* offsets, const int* targets, int edges) const;
+        bool validRows() const;
+
+        // Helper method that unmaps the file
+        void close();
+
+        // Helper method that flushes a file or a directory to the disk, it returns false if it
+        // could not be opened or flushed
+        static bool syncToDisk(const string& path);
+};
+
+#endif
@@ -0,0 +1,98 @@
+// --------------------------- graphstats.cpp --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphstats.cpp file is the implementation file for the
+// GraphStats struct and the StatsTimer class.
+// ---------------------------------------------------------------------
+// Notes - The timer uses the steady clock, so changes to the time of day
+// while a phase is running do not change its timing.
+// ---------------------------------------------------------------------
+#include "graphstats.h"
+#include <chrono>
+#include <algorithm>
+using namespace std;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The GraphStats constructor sets every counter and timing to 0.
+// -------------------------------------------------------------------------------------------
+GraphStats::GraphStats()
+{
+    reset();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[reset]------------------------------------------------
+// Description: The reset method sets every counter and timing back to 0, it is called before
+// a query whose work is to be measured on its own.
+// -------------------------------------------------------------------------------------------
+void GraphStats::reset()
+{
+    nodesSettled = 0;
+    edgesRelaxed = 0;
+    heapPushes = 0;
+    heapPops = 0;
+    decreaseKeys = 0;
+    searchEdges = 0;
+    maxStackDepth = 0;
+    buildSeconds = 0;
+    computeSeconds = 0;
+    displaySeconds = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[add]-------------------------------------------------
+// Description: The add method adds the counters and timings of other to these, it is used to
+// gather the stats the threads of a parallel search kept on their own. The deepest stack of
+// the two is kept instead of adding them.
+// -------------------------------------------------------------------------------------------
+void GraphStats::add(const GraphStats& other)
+{
+    nodesSettled += other.nodesSettled;
+    edgesRelaxed += other.edgesRelaxed;
+    heapPushes += other.heapPushes;
+    heapPops += other.heapPops;
+    decreaseKeys += other.decreaseKeys;
+    searchEdges += other.searchEdges;
+    maxStackDepth = max(maxStackDepth, other.maxStackDepth);
+    buildSeconds += other.buildSeconds;
+    computeSeconds += other.computeSeconds;
+    displaySeconds += other.displaySeconds;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The StatsTimer constructor remembers the timing to add to and starts timing.
+// -------------------------------------------------------------------------------------------
+StatsTimer::StatsTimer(double& seconds) : total(seconds)
+{
+    start = chrono::steady_clock::now();
+    running = true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[Destructor]---------------------------------------------
+// Description: The StatsTimer destructor adds the time to the total if stop was not called.
+// -------------------------------------------------------------------------------------------
+StatsTimer::~StatsTimer()
+{
+    stop();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[stop]------------------------------------------------
+// Description: The stop method adds the time since the timer was started to the total. It
+// is called before a phase hands its work on to a method with a timer of its own, so the
+// same time is not counted twice.
+// -------------------------------------------------------------------------------------------
+void StatsTimer::stop()
+{
+    if (running)
+    {
+        total += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        running = false;
+    }
+}
+// -------------------------------------------------------------------------------------------
@@ -0,0 +1,87 @@
+// ---------------------------- graphstats.h ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The graphstats.h file is the header file for the GraphStats
+// struct, which holds the counters and timings that GraphM and GraphL keep
+// about the work their algorithms do, and the StatsTimer class, which adds
+// the time spent in a phase to one of those timings.
+// ---------------------------------------------------------------------
+// Notes - The counters are only kept when the program is compiled with
+// GRAPH_STATS defined (-DGRAPH_STATS). Otherwise the macros below expand
+// to nothing but a use of the stats object, so the hot loops are the same
+// as without them, and every field of the stats stays at 0. The struct
+// itself is always there, so code that reads the stats compiles either
+// way. A GraphStats object is not safe to share between threads, threads
+// count into their own object and the objects are added together when
+// the threads are done.
+// ---------------------------------------------------------------------
+#ifndef GRAPH_STATS_H
+#define GRAPH_STATS_H
+#include <chrono>
+using namespace std;
+
+// The GraphStats struct holds the counters of the shortest path and depth-first searches and
+// the time spent in each phase, in seconds
+struct GraphStats
+{
+    // Dijkstra's algorithm: nodes taken off the heap and visited, edges followed out of them,
+    // nodes put in the heap and distances of nodes already in the heap made shorter
+    long long nodesSettled;
+    long long edgesRelaxed;
+    long long heapPushes;
+    long long heapPops;
+    long long decreaseKeys;
+
+    // Depth-first search: edges followed and the deepest the search stack has been
+    long long searchEdges;
+    long long maxStackDepth;
+
+    // Time spent building the graph, computing paths or orderings, and displaying them
+    double buildSeconds;
+    double computeSeconds;
+    double displaySeconds;
+
+    // GraphStats constructor sets every counter and timing to 0
+    GraphStats();
+
+    // reset sets every counter and timing back to 0
+    void reset();
+
+    // add adds the counters and timings of other to these, the deepest stack of the two is kept
+    void add(const GraphStats& other);
+};
+
+class StatsTimer {
+
+    public:
+        // StatsTimer constructor starts timing, the time is added to seconds when the timer is
+        // stopped or destroyed
+        explicit StatsTimer(double& seconds);
+        ~StatsTimer();
+
+        // stop adds the time since the timer was started to the total, only the first call counts
+        void stop();
+
+    private:
+        // The timing the time is added to, and when the timer was started
+        double& total;
+        chrono::steady_clock::time_point start;
+        bool running;
+};
+
+#ifdef GRAPH_STATS
+#define GRAPH_STATS_ADD(stats, field, amount) ((stats).field += (amount))
+#define GRAPH_STATS_MAX(stats, field, value) ((stats).field = (stats).field < (value) ? (value) : (stats).field)
+#define GRAPH_STATS_TIMER(name, seconds) StatsTimer name(seconds)
+#define GRAPH_STATS_STOP(name) name.stop()
+#else
+#define GRAPH_STATS_ADD(stats, field, amount) ((void)(stats))
+#define GRAPH_STATS_MAX(stats, field, value) ((void)(stats))
+#define GRAPH_STATS_TIMER(name, seconds)
+#define GRAPH_STATS_STOP(name) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+// ----------------------------- heuristics.h --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The heuristics.h file contains the heuristic functors that
+// can be passed to GraphM::aStarShortestPath. A heuristic estimates the
+// shortest distance from a node to the target node of the search, and
+// A* search visits the nodes that look closest to the target first.
+// ---------------------------------------------------------------------
+// Notes - A heuristic is any type with a const call operator taking the
+// NodeData of a node and of the target node and returning an int. For
+// the search to stay exact the estimate must never be more than the
+// real shortest distance (admissible). The functors below use the
+// coordinates stored in NodeData and a scale that converts their
+// distance into edge weight units, the scale must be chosen so that no
+// edge is shorter than the scaled straight line between its nodes. The
+// estimate is rounded down so that it stays admissible, and 0 is returned
+// when either node has no coordinates.
+// ---------------------------------------------------------------------
+#ifndef HEURISTICS_H
+#define HEURISTICS_H
+#include "nodedata.h"
+#include <cmath>
+#include <algorithm>
+using namespace std;
+
+// The ZeroHeuristic struct makes A* search the same as Dijkstra's algorithm
+struct ZeroHeuristic
+{
+    int operator()(const NodeData&, const NodeData&) const
+    {
+        return 0;
+    }
+};
+
+// The EuclideanHeuristic struct estimates the straight line distance between planar coordinates
+struct EuclideanHeuristic
+{
+    // Number of edge weight units per unit of coordinate distance
+    double scale;
+
+    explicit EuclideanHeuristic(double weightPerUnit = 1.0) : scale(weightPerUnit) { }
+
+    int operator()(const NodeData& node, const NodeData& target) const
+    {
+        if (!node.hasCoordinates() || !target.hasCoordinates())
+        {
+            return 0;
+        }
+
+        double deltaX = node.getX() - target.getX();
+        double deltaY = node.getY() - target.getY();
+        return static_cast<int>(floor(sqrt(deltaX * deltaX + deltaY * deltaY) * scale));
+    }
+};
+
+// The HaversineHeuristic struct estimates the great circle distance between coordinates
+// given as x = longitude and y = latitude in degrees
+struct HaversineHeuristic
+{
+    // Number of edge weight units per kilometer
+    double scale;
+
+    explicit HaversineHeuristic(double weightPerKilometer = 1.0) : scale(weightPerKilometer) { }
+
+    int operator()(const NodeData& node, const NodeData& target) const
+    {
+        if (!node.hasCoordinates() || !target.hasCoordinates())
+        {
+            return 0;
+        }
+
+        const double earthRadius = 6371.0;
+        const double radiansPerDegree = 3.14159265358979323846 / 180.0;
+
+        double latitude1 = node.getY() * radiansPerDegree;
+        double latitude2 = target.getY() * radiansPerDegree;
+        double deltaLatitude = latitude2 - latitude1;
+        double deltaLongitude = (target.getX() - node.getX()) * radiansPerDegree;
+
+        double a = sin(deltaLatitude / 2) * sin(deltaLatitude / 2) +
+                   cos(latitude1) * cos(latitude2) * sin(deltaLongitude / 2) * sin(deltaLongitude / 2);
+        double kilometers = 2 * earthRadius * asin(sqrt(min(1.0, a)));
+        return static_cast<int>(floor(kilometers * scale));
+    }
+};
+
+#endif
@@ -0,0 +1,295 @@
+// --------------------------- indexedheap.h ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The indexedheap.h file is the header file for the IndexedHeap
+// class template, which is a d-ary min-heap of node subscripts keyed by
+// their tentative distance. It is the priority queue used by GraphM to
+// pick the next unvisited node with the shortest distance in Dijkstra's
+// shortest path algorithm.
+// ---------------------------------------------------------------------
+// Notes - The heap keeps a position array indexed by node subscript so that
+// a node that is already in the heap can have its distance decreased in
+// place (decrease-key) instead of being pushed a second time. Ties between
+// equal distances are broken by the smaller node subscript, which gives the
+// same visiting order as a linear scan over the nodes from 1 to size. The
+// Arity template parameter sets the number of children of each heap
+// node, 2 gives a binary heap and 4 (the default) gives a 4-ary heap.
+// ---------------------------------------------------------------------
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+#include <vector>
+using namespace std;
+
+template <int Arity = 4>
+class IndexedHeap {
+
+    public:
+        // IndexedHeap constructor creates an empty heap that can hold
+        // the node subscripts 0 to capacity - 1
+        explicit IndexedHeap(int capacity = 0);
+
+        // resize empties the heap and changes the range of node subscripts it can hold
+        void resize(int capacity);
+
+        // Methods for checking the contents of the heap
+        bool empty() const;
+        bool contains(int node) const;
+
+        // push inserts a node with the given distance, or decreases the distance
+        // of the node if it is already in the heap
+        void push(int node, int distance);
+
+        // minDistance returns the shortest distance in the heap without removing its node
+        int minDistance() const;
+
+        // popMin removes and returns the node with the shortest distance
+        int popMin();
+
+        // clear removes all of the nodes from the heap
+        void clear();
+
+    private:
+        // The HeapEntry struct stores a node subscript and its distance
+        struct HeapEntry
+        {
+            int distance;
+            int node;
+        };
+
+        // Array based heap of entries, the root is at subscript 0
+        vector<HeapEntry> entries;
+
+        // Position of each node subscript in entries, or -1 if the node is not in the heap
+        vector<int> position;
+
+        // Helper methods used to restore the heap order after an entry has moved
+        bool lessThan(const HeapEntry& left, const HeapEntry& right) const;
+        void siftUp(int index);
+        void siftDown(int index);
+};
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The IndexedHeap constructor creates an empty heap that can hold
+// the node subscripts from 0 to capacity - 1.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+IndexedHeap<Arity>::IndexedHeap(int capacity)
+{
+    resize(capacity);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[resize]------------------------------------------------
+// Description: The resize method empties the heap and sets the range of node
+// subscripts that can be stored in it.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+void IndexedHeap<Arity>::resize(int capacity)
+{
+    entries.clear();
+    entries.reserve(capacity);
+
+    // Every node starts outside of the heap
+    position.assign(capacity, -1);
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[empty]------------------------------------------------
+// Description: The empty method returns true if there are no nodes in the heap.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+bool IndexedHeap<Arity>::empty() const
+{
+    return entries.empty();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[contains]----------------------------------------------
+// Description: The contains method returns true if the given node is in the heap.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+bool IndexedHeap<Arity>::contains(int node) const
+{
+    return position[node] != -1;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[push]------------------------------------------------
+// Description: The push method inserts a node into the heap with the given distance.
+// If the node is already in the heap its distance is decreased in place, which is
+// the decrease-key operation of Dijkstra's shortest path algorithm.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+void IndexedHeap<Arity>::push(int node, int distance)
+{
+    // If the node is not in the heap yet, add it as the last entry
+    if (position[node] == -1)
+    {
+        position[node] = static_cast<int>(entries.size());
+        entries.push_back({distance, node});
+    }
+    // If the node is already in the heap, only a shorter distance is stored
+    else if (distance < entries[position[node]].distance)
+    {
+        entries[position[node]].distance = distance;
+    }
+    else
+    {
+        return;
+    }
+
+    // The entry can only have moved closer to the root
+    siftUp(position[node]);
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[minDistance]---------------------------------------------
+// Description: The minDistance method returns the shortest distance in the heap, the heap
+// must not be empty.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+int IndexedHeap<Arity>::minDistance() const
+{
+    return entries[0].distance;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[popMin]-----------------------------------------------
+// Description: The popMin method removes the node with the shortest distance from
+// the heap and returns its subscript, the smaller subscript is returned when two
+// nodes have the same distance.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+int IndexedHeap<Arity>::popMin()
+{
+    int minimumNode = entries[0].node;
+    position[minimumNode] = -1;
+
+    // The last entry replaces the root and is moved down to its place in the heap
+    HeapEntry lastEntry = entries.back();
+    entries.pop_back();
+
+    if (!entries.empty())
+    {
+        entries[0] = lastEntry;
+        position[lastEntry.node] = 0;
+        siftDown(0);
+    }
+
+    return minimumNode;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method removes all of the nodes from the heap without
+// releasing its memory so that it can be reused for the next source node.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+void IndexedHeap<Arity>::clear()
+{
+    for (const HeapEntry& entry : entries)
+    {
+        position[entry.node] = -1;
+    }
+    entries.clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[lessThan]----------------------------------------------
+// Description: The lessThan method compares two heap entries by distance and
+// then by node subscript.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+bool IndexedHeap<Arity>::lessThan(const HeapEntry& left, const HeapEntry& right) const
+{
+    if (left.distance != right.distance)
+    {
+        return left.distance < right.distance;
+    }
+    return left.node < right.node;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[siftUp]-----------------------------------------------
+// Description: The siftUp method moves the entry at the given index towards the
+// root until its parent is smaller than it.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+void IndexedHeap<Arity>::siftUp(int index)
+{
+    HeapEntry movingEntry = entries[index];
+
+    while (index > 0)
+    {
+        int parent = (index - 1) / Arity;
+
+        // Stop once the parent entry is smaller than the moving entry
+        if (!lessThan(movingEntry, entries[parent]))
+        {
+            break;
+        }
+
+        // The parent entry is moved down into the hole
+        entries[index] = entries[parent];
+        position[entries[index].node] = index;
+        index = parent;
+    }
+
+    entries[index] = movingEntry;
+    position[movingEntry.node] = index;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[siftDown]----------------------------------------------
+// Description: The siftDown method moves the entry at the given index away from
+// the root until all of its children are larger than it.
+// -------------------------------------------------------------------------------------------
+template <int Arity>
+void IndexedHeap<Arity>::siftDown(int index)
+{
+    HeapEntry movingEntry = entries[index];
+    int heapSize = static_cast<int>(entries.size());
+
+    while (true)
+    {
+        int firstChild = index * Arity + 1;
+
+        // Stop once the entry has no children
+        if (firstChild >= heapSize)
+        {
+            break;
+        }
+
+        // Find the smallest of the children
+        int lastChild = (firstChild + Arity < heapSize) ? firstChild + Arity : heapSize;
+        int smallestChild = firstChild;
+
+        for (int child = firstChild + 1; child < lastChild; child++)
+        {
+            if (lessThan(entries[child], entries[smallestChild]))
+            {
+                smallestChild = child;
+            }
+        }
+
+        // Stop once the moving entry is smaller than all of its children
+        if (!lessThan(entries[smallestChild], movingEntry))
+        {
+            break;
+        }
+
+        // The smallest child is moved up into the hole
+        entries[index] = entries[smallestChild];
+        position[entries[index].node] = index;
+        index = smallestChild;
+    }
+
+    entries[index] = movingEntry;
+    position[movingEntry.node] = index;
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
@@ -10,52 +10,56 @@
 //   -- text files "data31.txt" and "data32.txt" are formatted as described 
 //   -- Data file data3uwb provides an additional data set for part 1;
 //      it must be edited, as it starts with a description how to use it
+//   -- the data files are read with a GraphLoader, which reads the same
+//      format as the ifstream version of buildGraph
+//   -- the graphs are processed by a GraphPipeline, which reads the next
+//      graphs while earlier ones are processed and prints them in order
 //---------------------------------------------------------------------------
 
 #include <iostream>
 #include <fstream>
 #include "graphl.h"
 #include "graphm.h"
+#include "graphloader.h"
+#include "graphpipeline.h"
 using namespace std;
 
 int main() {
 	
 	// part 1
-	ifstream infile1("data31.txt");
-	if (!infile1) {
+	GraphLoader infile1;
+	if (!infile1.open("data31.txt")) {
 		cout << "File could not be opened." << endl;
 		return 1;
 	}
 
+	GraphPipeline pipeline;
+
 	//for each graph, find the shortest path from every node to all other nodes
-	for (;;){
+	pipeline.run(infile1, true, [](const GraphText& graph, ostream& output) {
 		GraphM G;
-		G.buildGraph(infile1);
-		if (infile1.eof())
-			break;
+		G.buildGraph(graph);
 		G.findShortestPath();
-		G.displayAll();              // display shortest distance, path to cout
-		G.display(3, 1);              // display path from node 3 to 1 to cout
-		G.display(1, 2);
-		G.display(1, 4);
-	}
+		G.displayAll(output);        // display shortest distance, path to output
+		G.display(3, 1, output);     // display path from node 3 to 1 to output
+		G.display(1, 2, output);
+		G.display(1, 4, output);
+	}, cout);
 	
 	// part 2 
-	ifstream infile2("data32.txt");
-	if (!infile2) {
+	GraphLoader infile2;
+	if (!infile2.open("data32.txt")) {
 		cout << "File could not be opened." << endl;
 		return 1;
 	}
 
 	//for each graph, find the depth-first search ordering
-	for (;;) {
+	pipeline.run(infile2, false, [](const GraphText& graph, ostream& output) {
 		GraphL G;
-		G.buildGraph(infile2);
-		if (infile2.eof())
-			break;
-		G.displayGraph();
-		G.depthFirstSearch();    // find and display depth-first ordering to cout
-	}
+		G.buildGraph(graph);
+		G.displayGraph(output);
+		G.depthFirstSearch(output);  // find and display depth-first ordering to output
+	}, cout);
 	
 	cout << endl;
 	return 0;
@@ -1,18 +1,31 @@
 #include "nodedata.h"
 
 //------------------- constructors/destructor  -------------------------------
-NodeData::NodeData() { data = ""; }                         // default
+NodeData::NodeData() { data = ""; located = false; x = 0; y = 0; }  // default
 
 NodeData::~NodeData() { }            // needed so strings are deleted properly
 
-NodeData::NodeData(const NodeData& nd) { data = nd.data; }  // copy
+NodeData::NodeData(const NodeData& nd) {                     // copy
+	data = nd.data;
+	located = nd.located;
+	x = nd.x;
+	y = nd.y;
+}
 
-NodeData::NodeData(const string& s) { data = s; }    // cast string to NodeData
+NodeData::NodeData(const string& s) {                // cast string to NodeData
+	data = s;
+	located = false;
+	x = 0;
+	y = 0;
+}
 
 //------------------------- operator= ----------------------------------------
 NodeData& NodeData::operator=(const NodeData& rhs) {
 	if (this != &rhs) {
 		data = rhs.data;
+		located = rhs.located;
+		x = rhs.x;
+		y = rhs.y;
 	}
 	return *this;
 }
@@ -51,6 +64,33 @@ bool NodeData::setData(istream& infile) {
 	return !infile.eof();       // eof function is true when eof char is read
 }
 
+//------------------------------ getData -------------------------------------
+
+const string& NodeData::getData() const {
+	return data;
+}
+
+//------------------------ coordinates ---------------------------------------
+// the location is optional, nodes read from the data files have none
+
+void NodeData::setCoordinates(double newX, double newY) {
+	located = true;
+	x = newX;
+	y = newY;
+}
+
+bool NodeData::hasCoordinates() const {
+	return located;
+}
+
+double NodeData::getX() const {
+	return x;
+}
+
+double NodeData::getY() const {
+	return y;
+}
+
 //-------------------------- operator<< --------------------------------------
 ostream& operator<<(ostream& output, const NodeData& nd) {
 	output << nd.data;
@@ -22,6 +22,16 @@ public:
 	// returns true if the data is set, false when bad data, i.e., is eof
 	bool setData(istream&);
 
+	// the description string itself, used when writing a graph snapshot
+	const string& getData() const;
+
+	// optional location of the node, used by the A* search heuristics
+	// (for example x = longitude and y = latitude), not part of comparisons
+	void setCoordinates(double, double);
+	bool hasCoordinates() const;   // true once setCoordinates has been called
+	double getX() const;
+	double getY() const;
+
 	bool operator==(const NodeData &) const;
 	bool operator!=(const NodeData &) const;
 	bool operator<(const NodeData &) const;
@@ -31,6 +41,9 @@ public:
 
 private:
 	string data;
+	bool located;                  // true if x and y have been set
+	double x;
+	double y;
 };
 
 #endif
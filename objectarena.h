@@ -0,0 +1,188 @@
+// --------------------------- objectarena.h ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The objectarena.h file is the header file for the ObjectArena
+// class template, which is a bump allocator that creates objects in large
+// chunks of memory owned by the arena. GraphL uses it for the NodeData of
+// its nodes, so building a graph is a few large allocations instead of one
+// allocation per node and the memory is given back a chunk at a time.
+// ---------------------------------------------------------------------
+// Notes - Objects are constructed in place at the end of the last chunk,
+// and a new chunk is allocated when it is full. Objects can not be freed
+// one at a time, the clear method destroys every object and frees all of
+// the chunks at once. When T has a trivial destructor no destructors are
+// run, so clearing only frees the chunks. The pointers returned by create
+// stay valid until clear is called, since chunks are never moved. An arena
+// can not be copied because it owns its objects.
+// ---------------------------------------------------------------------
+#ifndef OBJECT_ARENA_H
+#define OBJECT_ARENA_H
+#include <vector>
+#include <new>
+#include <utility>
+#include <type_traits>
+using namespace std;
+
+template <typename T, int ChunkSize = 1024>
+class ObjectArena {
+
+    public:
+        // ObjectArena constructor creates an arena with no chunks, the destructor destroys
+        // every object and frees the chunks
+        ObjectArena();
+        ~ObjectArena();
+
+        // The arena owns its objects so it can not be copied
+        ObjectArena(const ObjectArena&) = delete;
+        ObjectArena& operator=(const ObjectArena&) = delete;
+
+        // reserve makes sure that count more objects can be created without allocating
+        // another chunk, the room is allocated as one chunk
+        void reserve(int count);
+
+        // create constructs a new object in the arena from the arguments and returns it
+        template <typename... Args>
+        T* create(Args&&... args);
+
+        // clear destroys every object in the arena and frees all of the chunks
+        void clear();
+
+        // size returns the number of objects in the arena
+        int size() const;
+
+    private:
+        // The Chunk struct is one block of memory with room for capacity objects,
+        // the first used of them have been constructed
+        struct Chunk
+        {
+            T* storage;
+            int capacity;
+            int used;
+        };
+
+        // Chunks allocated by the arena, objects are created in the last one
+        vector<Chunk> chunks;
+
+        // Number of objects in the arena
+        int objectCount;
+
+        // Helper method that allocates a chunk with room for capacity objects
+        void addChunk(int capacity);
+};
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The ObjectArena constructor creates an empty arena, no memory is allocated
+// until the first object is created.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+ObjectArena<T, ChunkSize>::ObjectArena()
+{
+    objectCount = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Destructor]----------------------------------------------
+// Description: The ObjectArena destructor destroys every object in the arena and frees
+// all of the chunks.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+ObjectArena<T, ChunkSize>::~ObjectArena()
+{
+    clear();
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[reserve]----------------------------------------------
+// Description: The reserve method allocates one chunk with room for count objects if the
+// last chunk does not already have that much room left.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+void ObjectArena<T, ChunkSize>::reserve(int count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if (chunks.empty() || chunks.back().capacity - chunks.back().used < count)
+    {
+        addChunk(count > ChunkSize ? count : ChunkSize);
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[create]-----------------------------------------------
+// Description: The create method constructs a new object from the arguments in the next
+// free slot of the last chunk, a new chunk is allocated first if the last one is full.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+template <typename... Args>
+T* ObjectArena<T, ChunkSize>::create(Args&&... args)
+{
+    if (chunks.empty() || chunks.back().used == chunks.back().capacity)
+    {
+        addChunk(ChunkSize);
+    }
+
+    Chunk& chunk = chunks.back();
+    T* object = new (chunk.storage + chunk.used) T(forward<Args>(args)...);
+    chunk.used++;
+    objectCount++;
+    return object;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[clear]-----------------------------------------------
+// Description: The clear method runs the destructor of every object in the arena, unless T
+// has a trivial destructor, and then frees each chunk with a single deallocation.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+void ObjectArena<T, ChunkSize>::clear()
+{
+    for (Chunk& chunk : chunks)
+    {
+        if constexpr (!is_trivially_destructible<T>::value)
+        {
+            for (int i = 0; i < chunk.used; i++)
+            {
+                chunk.storage[i].~T();
+            }
+        }
+
+        ::operator delete(static_cast<void*>(chunk.storage));
+    }
+
+    chunks.clear();
+    objectCount = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[size]------------------------------------------------
+// Description: The size method returns the number of objects created since the last clear.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+int ObjectArena<T, ChunkSize>::size() const
+{
+    return objectCount;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[addChunk]---------------------------------------------
+// Description: The addChunk method allocates uninitialized memory for capacity objects and
+// makes it the last chunk, the objects are constructed in it by create.
+// -------------------------------------------------------------------------------------------
+template <typename T, int ChunkSize>
+void ObjectArena<T, ChunkSize>::addChunk(int capacity)
+{
+    Chunk chunk;
+    chunk.storage = static_cast<T*>(::operator new(sizeof(T) * capacity));
+    chunk.capacity = capacity;
+    chunk.used = 0;
+    chunks.push_back(chunk);
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,164 @@
+// --------------------------- outputbuffer.cpp ------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The outputbuffer.cpp file is the implementation file for the
+// OutputBuffer class. It contains the constructors and destructor and the
+// methods that write the buffered text to the sink.
+// ---------------------------------------------------------------------
+// Notes - Writing to a file descriptor repeats the write until every
+// character has been written, since a write to a pipe or a terminal can
+// write fewer characters than it was given. A write that fails for any
+// other reason than an interrupt sets the failed flag and keeps its errno,
+// the rest of the buffer is dropped since the sink will not take it.
+// ---------------------------------------------------------------------
+#include "outputbuffer.h"
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cerrno>
+#include <unistd.h>
+using namespace std;
+
+// Number of characters collected before the buffer is written to its sink
+const size_t OUTPUT_BUFFER_SIZE = 1 << 16;
+
+// ---------------------------------[Constructors]--------------------------------------------
+// Description: The OutputBuffer constructors create an empty buffer that writes to a file
+// descriptor, appends to a string or writes to an output stream.
+// -------------------------------------------------------------------------------------------
+OutputBuffer::OutputBuffer(int fileDescriptor)
+{
+    initialize(FILE_SINK);
+    sinkFile = fileDescriptor;
+}
+
+OutputBuffer::OutputBuffer(string& text)
+{
+    initialize(STRING_SINK);
+    sinkString = &text;
+}
+
+OutputBuffer::OutputBuffer(ostream& stream)
+{
+    initialize(STREAM_SINK);
+    sinkStream = &stream;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[Destructor]----------------------------------------------
+// Description: The OutputBuffer destructor writes the text left in the buffer to the sink,
+// the sink is not flushed.
+// -------------------------------------------------------------------------------------------
+OutputBuffer::~OutputBuffer()
+{
+    drain();
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[drain]-----------------------------------------------
+// Description: The drain method writes the text in the buffer to the sink in one piece and
+// empties the buffer. If the sink does not take all of it, the failure is remembered.
+// -------------------------------------------------------------------------------------------
+void OutputBuffer::drain()
+{
+    if (used == 0)
+    {
+        return;
+    }
+
+    if (sinkKind == FILE_SINK)
+    {
+        size_t written = 0;
+
+        while (written < used)
+        {
+            ssize_t result = ::write(sinkFile, storage.get() + written, used - written);
+
+            // A write that was interrupted is tried again, any other error drops the text
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (result <= 0)
+            {
+                failed = true;
+                sinkError = result < 0 ? errno : EIO;
+                break;
+            }
+
+            written += result;
+        }
+    }
+    else if (sinkKind == STRING_SINK)
+    {
+        sinkString->append(storage.get(), used);
+    }
+    else
+    {
+        sinkStream->write(storage.get(), used);
+        failed = failed || !*sinkStream;
+    }
+
+    used = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[flush]-----------------------------------------------
+// Description: The flush method writes the text in the buffer to the sink and flushes the
+// sink if it is a stream, text written to a file descriptor is already with the system. It
+// returns false if any text could not be written since the buffer was created.
+// -------------------------------------------------------------------------------------------
+bool OutputBuffer::flush()
+{
+    drain();
+
+    if (sinkKind == STREAM_SINK)
+    {
+        sinkStream->flush();
+        failed = failed || !*sinkStream;
+    }
+    return !failed;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[good]------------------------------------------------
+// Description: The good method returns true if all of the text written to the sink so far was
+// written, text still in the buffer has not been tried yet.
+// -------------------------------------------------------------------------------------------
+bool OutputBuffer::good() const
+{
+    return !failed;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[writeError]---------------------------------------------
+// Description: The writeError method returns the errno of the write to a file descriptor that
+// failed, or 0 if none has failed or the sink is not a file descriptor.
+// -------------------------------------------------------------------------------------------
+int OutputBuffer::writeError() const
+{
+    return sinkError;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[initialize]---------------------------------------------
+// Description: The initialize method sets the kind of sink and allocates the buffer with new
+// instead of a vector, so its memory is not filled in until text is written to it.
+// -------------------------------------------------------------------------------------------
+void OutputBuffer::initialize(SinkKind kind)
+{
+    sinkKind = kind;
+    sinkFile = -1;
+    sinkString = nullptr;
+    sinkStream = nullptr;
+    storage.reset(new char[OUTPUT_BUFFER_SIZE]);
+    capacity = OUTPUT_BUFFER_SIZE;
+    used = 0;
+    failed = false;
+    sinkError = 0;
+}
+// -------------------------------------------------------------------------------------------
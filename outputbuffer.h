@@ -0,0 +1,153 @@
+// ---------------------------- outputbuffer.h -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The outputbuffer.h file is the header file for the
+// OutputBuffer class, which collects output text in a buffer and writes
+// it to a sink in large chunks. The display methods of GraphM and GraphL
+// write to an OutputBuffer instead of writing to cout one token at a time,
+// so printing the table of a large graph does not go through the stream
+// formatting and flushing for every number and line.
+// ---------------------------------------------------------------------
+// Notes - The sink is a file descriptor, a string or an output stream.
+// The text is written to the sink once the buffer is full and when the
+// OutputBuffer is destroyed. Writing a newline does not flush anything,
+// the sink itself is only flushed when the flush method is called. The
+// buffer's memory is allocated but not filled in, so a buffer made for a
+// single display call does not clear 64 KiB it may never use. A failed
+// write to the sink is remembered, good and flush report it like the
+// failbit of a stream, and the text that could not be written is dropped.
+// Integers are formatted with to_chars, which gives the same text as the
+// stream operator for an int. The methods that add text to the buffer are
+// defined inline at the end of this file.
+// ---------------------------------------------------------------------
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cstring>
+#include <charconv>
+using namespace std;
+
+class OutputBuffer {
+
+    public:
+        // OutputBuffer constructors create a buffer that writes to a file descriptor, appends
+        // to a string or writes to an output stream, the destructor writes what is left
+        explicit OutputBuffer(int fileDescriptor);
+        explicit OutputBuffer(string& text);
+        explicit OutputBuffer(ostream& stream);
+        ~OutputBuffer();
+
+        // The buffer writes to its sink when it is destroyed, so it can not be copied
+        OutputBuffer(const OutputBuffer&) = delete;
+        OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+        // Methods for adding text and integers to the buffer
+        OutputBuffer& operator<<(const string& text);
+        OutputBuffer& operator<<(const char* text);
+        OutputBuffer& operator<<(char character);
+        OutputBuffer& operator<<(int number);
+
+        // write adds length characters to the buffer
+        void write(const char* text, size_t length);
+
+        // drain writes the text in the buffer to the sink without flushing the sink
+        void drain();
+
+        // flush writes the text in the buffer to the sink and flushes the sink, it returns false
+        // if any text could not be written to the sink since the buffer was created
+        bool flush();
+
+        // good returns true if all of the text written to the sink so far was written, and
+        // writeError returns the errno of the failed write to a file descriptor, or 0
+        bool good() const;
+        int writeError() const;
+
+    private:
+        // Kinds of sink the buffer can write to
+        enum SinkKind
+        {
+            FILE_SINK,
+            STRING_SINK,
+            STREAM_SINK
+        };
+
+        // The sink the buffer writes to, only the member for its kind is used
+        SinkKind sinkKind;
+        int sinkFile;
+        string* sinkString;
+        ostream* sinkStream;
+
+        // Text that has not been written to the sink yet, the first used of the capacity
+        // characters of storage, which are left uninitialized until text is written to them
+        unique_ptr<char[]> storage;
+        size_t capacity;
+        size_t used;
+
+        // Set once a write to the sink has failed, and the errno of a failed write to a file
+        bool failed;
+        int sinkError;
+
+        // Helper method that sets up an empty buffer
+        void initialize(SinkKind kind);
+};
+
+// ------------------------------------[write]------------------------------------------------
+// Description: The write method adds the characters to the buffer, the buffer is written to
+// the sink first if they do not fit. The buffer grows to hold text longer than all of it.
+// -------------------------------------------------------------------------------------------
+inline void OutputBuffer::write(const char* text, size_t length)
+{
+    if (used + length > capacity)
+    {
+        drain();
+
+        if (length > capacity)
+        {
+            storage.reset(new char[length]);
+            capacity = length;
+        }
+    }
+
+    memcpy(storage.get() + used, text, length);
+    used += length;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[operator<<]---------------------------------------------
+// Description: The operator<< methods add a string, a C string, a character or an integer
+// to the buffer and return the buffer so that they can be chained like a stream.
+// -------------------------------------------------------------------------------------------
+inline OutputBuffer& OutputBuffer::operator<<(const string& text)
+{
+    write(text.data(), text.size());
+    return *this;
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(const char* text)
+{
+    write(text, strlen(text));
+    return *this;
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(char character)
+{
+    write(&character, 1);
+    return *this;
+}
+
+inline OutputBuffer& OutputBuffer::operator<<(int number)
+{
+    // An int has at most 11 characters, including the minus sign
+    char digits[12];
+    to_chars_result result = to_chars(digits, digits + sizeof(digits), number);
+    write(digits, result.ptr - digits);
+    return *this;
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
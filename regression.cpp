@@ -0,0 +1,483 @@
+// ---------------------------- regression.cpp -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The regression.cpp file is a check program for bugs that
+// were found in the GraphM class, the CsrGraph and WeightTraits it is
+// built on, and the GraphPipeline and OutputBuffer that lab3 runs the
+// graphs through. Each check builds a small graph or sum that brought
+// out a bug, runs it and compares the result with the one it should
+// give, and the program prints PASS or FAIL for every check.
+// ---------------------------------------------------------------------
+// Notes - It is built on its own instead of lab3.cpp, for example with
+//   g++ -O2 -std=c++17 -o regression regression.cpp graphm.cpp graphl.cpp
+//       nodedata.cpp csrgraph.cpp searchspace.cpp contractionhierarchy.cpp
+//       graphloader.cpp graphsnapshot.cpp graphpipeline.cpp
+//       outputbuffer.cpp tablerow.cpp densegraph.cpp floydwarshall.cpp
+//       graphstats.cpp -lpthread
+// The program returns 1 if any check fails. A graph whose rows of T were
+// repaired after an edge change is compared with a graph built from the
+// edges after the change, whose rows are computed from scratch, so the
+// display output of the two has to be the same. The rows of a CsrGraph
+// are compared with plain lists of edges after every edge change, and the
+// saturating sums of WeightTraits are checked at the limits of an int.
+// The pipeline check reads data31.txt, so the program is run from the
+// directory that holds it.
+// ---------------------------------------------------------------------
+#include "graphm.h"
+#include "csrgraph.h"
+#include "graphloader.h"
+#include "weighttraits.h"
+#include "graphpipeline.h"
+#include "outputbuffer.h"
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <climits>
+#include <cstdio>
+#include <stdexcept>
+#include <cerrno>
+using namespace std;
+
+// -----------------------------------[makeGraph]---------------------------------------------
+// Description: The makeGraph function fills in a graph with the number of nodes and the list
+// of edges, each node is described by its number.
+// -------------------------------------------------------------------------------------------
+static GraphText makeGraph(int nodes, const vector<CsrEdge>& edges)
+{
+    GraphText graph;
+    graph.nodeCount = nodes;
+
+    for (int node = 1; node <= nodes; node++)
+    {
+        graph.descriptions.push_back("node " + to_string(node));
+    }
+
+    graph.edges = edges;
+    return graph;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[displayedTable]-------------------------------------------
+// Description: The displayedTable function returns the text displayAll prints for the graph.
+// -------------------------------------------------------------------------------------------
+static string displayedTable(GraphM& graph)
+{
+    ostringstream output;
+    graph.displayAll(output);
+    return output.str();
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[matchesFresh]---------------------------------------------
+// Description: The matchesFresh function returns true if the repaired graph displays the same
+// table as a graph built from the edges after the change with every row computed again.
+// -------------------------------------------------------------------------------------------
+static bool matchesFresh(GraphM& repaired, const GraphText& changedGraph)
+{
+    GraphM fresh;
+    fresh.buildGraph(changedGraph);
+    fresh.findShortestPath();
+    return displayedTable(repaired) == displayedTable(fresh);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[report]------------------------------------------------
+// Description: The report function prints the result of a check and returns 1 if it failed.
+// -------------------------------------------------------------------------------------------
+static int report(const string& name, bool passed)
+{
+    cout << (passed ? "PASS " : "FAIL ") << name << endl;
+    return passed ? 0 : 1;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[checkRepairSaturates]---------------------------------------
+// Description: The checkRepairSaturates function checks that repairing a row of T after an
+// edge change leaves a node unreached when its distance would be past the largest int,
+// instead of wrapping around to a negative distance. The checks return the number of them
+// that failed.
+// -------------------------------------------------------------------------------------------
+static int checkRepairSaturates()
+{
+    int failures = 0;
+    vector<int> path;
+
+    // A new edge in front of an edge of weight INT_MAX - 1, repaired by decreaseEdge
+    {
+        GraphM graph;
+        graph.buildGraph(makeGraph(3, {{2, 3, INT_MAX - 1}}));
+        graph.findShortestPath();
+        graph.insertEdge(1, 2, 5);
+
+        bool passed = graph.getPath(1, 3, path) == INT_MAX && path.empty() &&
+                      matchesFresh(graph, makeGraph(3, {{1, 2, 5}, {2, 3, INT_MAX - 1}}));
+        failures += report("insertEdge before a large edge leaves the node unreached", passed);
+    }
+
+    // A larger weight on the edge in front of a large edge, repaired by increaseEdge
+    {
+        GraphM graph;
+        graph.buildGraph(makeGraph(3, {{1, 2, 1}, {2, 3, INT_MAX - 2}}));
+        graph.findShortestPath();
+        graph.insertEdge(1, 2, 5);
+
+        bool passed = graph.getPath(1, 3, path) == INT_MAX && path.empty() &&
+                      matchesFresh(graph, makeGraph(3, {{1, 2, 5}, {2, 3, INT_MAX - 2}}));
+        failures += report("a larger weight before a large edge leaves the node unreached", passed);
+    }
+
+    // The same change as the first check made in a batch, which asks rowAffected first
+    {
+        GraphM graph;
+        graph.buildGraph(makeGraph(3, {{2, 3, INT_MAX - 1}}));
+        graph.findShortestPath();
+        graph.updateEdges({{1, 2, 5, false}});
+
+        bool passed = graph.getPath(1, 3, path) == INT_MAX && path.empty() &&
+                      matchesFresh(graph, makeGraph(3, {{1, 2, 5}, {2, 3, INT_MAX - 1}}));
+        failures += report("updateEdges before a large edge leaves the node unreached", passed);
+    }
+
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------[checkAStarSaturates]----------------------------------------
+// Description: The checkAStarSaturates function checks that A* search adds the estimate of a
+// node to its distance without overflowing, when the distance is close to the largest int.
+// The checks return the number of them that failed.
+// -------------------------------------------------------------------------------------------
+static int checkAStarSaturates()
+{
+    int failures = 0;
+    vector<int> path;
+
+    GraphM graph;
+    graph.buildGraph(makeGraph(3, {{1, 2, INT_MAX - 50}, {2, 3, 1}}));
+    auto estimate = [](const NodeData&, const NodeData&) { return 100; };
+
+    bool passed = graph.aStarShortestPath(1, 3, path, estimate) == INT_MAX - 49 && path == vector<int>{1, 2, 3};
+    failures += report("A* adds an estimate to a distance close to INT_MAX", passed);
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------[checkHierarchyIsKept]-----------------------------------------
+// Description: The checkHierarchyIsKept function checks that picking or loading landmarks does
+// not throw away a contraction hierarchy that has been built, even when the landmark file
+// can not be loaded, while an edge change still does. The checks return the number of them
+// that failed.
+// -------------------------------------------------------------------------------------------
+static int checkHierarchyIsKept()
+{
+    int failures = 0;
+
+    GraphM graph;
+    graph.buildGraph(makeGraph(4, {{1, 2, 3}, {2, 3, 4}, {3, 4, 5}, {1, 4, 20}}));
+    graph.buildContractionHierarchy();
+
+    graph.preprocessLandmarks(2);
+    failures += report("preprocessLandmarks keeps the contraction hierarchy", graph.hasContractionHierarchy());
+
+    bool loaded = graph.loadLandmarks("regression-missing-landmarks.bin");
+    failures += report("a failed loadLandmarks keeps the contraction hierarchy",
+                       !loaded && graph.hasContractionHierarchy());
+
+    graph.insertEdge(1, 3, 2);
+    failures += report("insertEdge throws away the contraction hierarchy", !graph.hasContractionHierarchy());
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------[checkLandmarksMatchGraph]--------------------------------------
+// Description: The checkLandmarksMatchGraph function checks that a landmark file is only
+// loaded by the graph it was written for, and not by a graph with the same number of nodes
+// and edges but other edges. The checks return the number of them that failed.
+// -------------------------------------------------------------------------------------------
+static int checkLandmarksMatchGraph()
+{
+    int failures = 0;
+    const string fileName = "regression-landmarks.bin";
+
+    GraphM written;
+    written.buildGraph(makeGraph(4, {{1, 2, 3}, {2, 3, 4}, {3, 4, 5}, {1, 4, 20}}));
+    written.preprocessLandmarks(2);
+    bool saved = written.saveLandmarks(fileName);
+
+    GraphM same;
+    same.buildGraph(makeGraph(4, {{1, 2, 3}, {2, 3, 4}, {3, 4, 5}, {1, 4, 20}}));
+    failures += report("landmarks load into the graph they were written for", saved && same.loadLandmarks(fileName));
+
+    GraphM other;
+    other.buildGraph(makeGraph(4, {{1, 2, 30}, {2, 3, 4}, {3, 4, 5}, {1, 4, 20}}));
+    failures += report("landmarks of another graph with as many edges are rejected", !other.loadLandmarks(fileName));
+
+    remove(fileName.c_str());
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------[checkSnapshotByteOrder]----------------------------------------
+// Description: The checkSnapshotByteOrder function checks that a saved snapshot loads back,
+// and that it is rejected once the byte order word of its header is swapped around, the way
+// a machine with the other byte order would read it. The checks return the number of them
+// that failed.
+// -------------------------------------------------------------------------------------------
+static int checkSnapshotByteOrder()
+{
+    int failures = 0;
+    const string fileName = "regression-snapshot.bin";
+
+    GraphM graph;
+    graph.buildGraph(makeGraph(3, {{1, 2, 3}, {2, 3, 4}}));
+    graph.findShortestPath();
+    bool saved = graph.saveSnapshot(fileName);
+
+    GraphM loaded;
+    failures += report("a saved snapshot loads back", saved && loaded.loadSnapshot(fileName) &&
+                                                       displayedTable(loaded) == displayedTable(graph));
+
+    // The byte order word follows the tag, the version and five counts of the header
+    fstream file(fileName, ios::in | ios::out | ios::binary);
+    unsigned char byteOrder[4];
+    file.seekg(7 * 4);
+    file.read(reinterpret_cast<char*>(byteOrder), 4);
+    swap(byteOrder[0], byteOrder[3]);
+    swap(byteOrder[1], byteOrder[2]);
+    file.seekp(7 * 4);
+    file.write(reinterpret_cast<const char*>(byteOrder), 4);
+    file.close();
+
+    GraphM swapped;
+    failures += report("a snapshot with the other byte order is rejected", !swapped.loadSnapshot(fileName));
+
+    remove(fileName.c_str());
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[matchesRows]---------------------------------------------
+// Description: The matchesRows function returns true if every node of the graph has the same
+// edges, in the same order, as the node's row in the list of rows.
+// -------------------------------------------------------------------------------------------
+static bool matchesRows(const CsrGraph& graph, const vector<vector<CsrEdge>>& rows)
+{
+    int edges = 0;
+
+    for (int node = 1; node < static_cast<int>(rows.size()); node++)
+    {
+        if (graph.endEdge(node) - graph.beginEdge(node) != static_cast<int>(rows[node].size()))
+        {
+            return false;
+        }
+
+        for (int edge = graph.beginEdge(node); edge < graph.endEdge(node); edge++)
+        {
+            const CsrEdge& expected = rows[node][edge - graph.beginEdge(node)];
+
+            if (graph.edgeTarget(edge) != expected.toNode || graph.edgeWeight(edge) != expected.weight)
+            {
+                return false;
+            }
+        }
+        edges += static_cast<int>(rows[node].size());
+    }
+    return graph.edgeCount() == edges;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[checkEdgeChanges]------------------------------------------
+// Description: The checkEdgeChanges function checks that a CsrGraph keeps the right edges in
+// the right order through many inserted, changed and removed edges, while its rows grow, move
+// and are compacted, and that a GraphM whose edges were changed saves a snapshot that loads
+// back with the same table. The checks return the number of them that failed.
+// -------------------------------------------------------------------------------------------
+static int checkEdgeChanges()
+{
+    int failures = 0;
+    const int nodes = 20;
+    const string fileName = "regression-edges.bin";
+
+    CsrGraph graph;
+    graph.build(nodes, {{1, 2, 5}, {1, 3, 6}, {4, 1, 7}}, false);
+    vector<vector<CsrEdge>> rows(nodes + 1);
+    rows[1] = {{1, 2, 5}, {1, 3, 6}};
+    rows[4] = {{4, 1, 7}};
+
+    // A small linear congruential generator picks the edges, so every run makes the same changes
+    unsigned int state = 12345;
+    bool matched = true;
+    bool compacted = false;
+
+    for (int change = 0; change < 20000 && matched; change++)
+    {
+        state = state * 1103515245 + 12345;
+        int fromNode = 1 + (state >> 8) % nodes;
+        int toNode = 1 + (state >> 16) % nodes;
+        vector<CsrEdge>& row = rows[fromNode];
+        size_t position = 0;
+
+        while (position < row.size() && row[position].toNode != toNode)
+        {
+            position++;
+        }
+
+        // Two changes in five remove the edge, the others insert it or change its weight
+        if ((state >> 24) % 5 < 2)
+        {
+            bool removed = graph.removeEdge(fromNode, toNode);
+            matched = removed == (position < row.size());
+
+            if (removed)
+            {
+                row.erase(row.begin() + position);
+            }
+        }
+        else
+        {
+            int weight = static_cast<int>(state >> 20);
+            graph.setEdge(fromNode, toNode, weight);
+
+            if (position < row.size())
+            {
+                row[position].weight = weight;
+            }
+            else
+            {
+                row.push_back({fromNode, toNode, weight});
+            }
+        }
+
+        matched = matched && matchesRows(graph, rows);
+        compacted = compacted || graph.isCompact();
+    }
+
+    failures += report("changed edges keep their rows", matched && compacted);
+    graph.compact();
+    failures += report("a compacted graph keeps its rows", graph.isCompact() && matchesRows(graph, rows));
+
+    GraphM changed;
+    changed.buildGraph(makeGraph(4, {{1, 2, 1}, {2, 3, 1}, {3, 4, 1}}));
+    changed.findShortestPath();
+    changed.insertEdge(1, 4, 2);
+    changed.removeEdge(2, 3);
+    changed.insertEdge(4, 2, 1);
+    bool saved = changed.saveSnapshot(fileName);
+
+    GraphM loaded;
+    failures += report("a graph with changed edges saves a snapshot", saved && loaded.loadSnapshot(fileName) &&
+                                                                       displayedTable(loaded) == displayedTable(changed));
+
+    remove(fileName.c_str());
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------[checkPipelineRethrows]------------------------------------------
+// Description: The checkPipelineRethrows function checks that an exception thrown by the task
+// of one graph comes back out of GraphPipeline::run on the calling thread, after the output
+// of the graph before it has been written, instead of ending the program. The checks return
+// the number of them that failed.
+// -------------------------------------------------------------------------------------------
+static int checkPipelineRethrows()
+{
+    GraphLoader loader;
+
+    if (!loader.open("data31.txt"))
+    {
+        return report("data31.txt can be opened for the pipeline check", false);
+    }
+
+    // The first graph of data31.txt has 5 nodes and the second one has 3
+    ostringstream output;
+    bool rethrown = false;
+    GraphPipeline pipeline(2);
+
+    try
+    {
+        pipeline.run(loader, true, [](const GraphText& graph, ostream& graphOutput)
+        {
+            if (graph.nodeCount == 3)
+            {
+                throw runtime_error("task failed");
+            }
+            graphOutput << "graph of " << graph.nodeCount << " nodes" << endl;
+        }, output);
+    }
+    catch (const runtime_error& error)
+    {
+        rethrown = string(error.what()) == "task failed";
+    }
+
+    return report("an exception in a pipeline task is thrown again by run",
+                  rethrown && output.str() == "graph of 5 nodes\n");
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------[checkOutputReportsErrors]---------------------------------------
+// Description: The checkOutputReportsErrors function checks that an OutputBuffer whose file
+// descriptor can not be written to reports the failure through good, flush and writeError,
+// and that a buffer whose writes succeed reports none. The checks return the number of them
+// that failed.
+// -------------------------------------------------------------------------------------------
+static int checkOutputReportsErrors()
+{
+    int failures = 0;
+
+    // -1 is never an open file descriptor, so every write to it fails with EBADF
+    OutputBuffer closedFile(-1);
+    closedFile << "text that can not be written" << '\n';
+    bool flushed = closedFile.flush();
+    failures += report("a failed write to a file descriptor is reported",
+                       !flushed && !closedFile.good() && closedFile.writeError() == EBADF);
+
+    string text;
+    OutputBuffer toString(text);
+    toString << "distance " << 42 << '\n';
+    failures += report("a buffer with no failed writes is good", toString.flush() && toString.good() &&
+                                                                   text == "distance 42\n");
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------[checkWeightTraits]-----------------------------------------
+// Description: The checkWeightTraits function checks that WeightTraits<int> keeps infinity at
+// infinity, adds a weight to a distance that has room for it, gives infinity for a sum past
+// INT_MAX and stops at INT_MIN for a sum below it. The checks return the number of them that
+// failed.
+// -------------------------------------------------------------------------------------------
+static int checkWeightTraits()
+{
+    typedef WeightTraits<int> Traits;
+    int failures = 0;
+
+    failures += report("infinity plus a weight is infinity", Traits::extend(Traits::infinity(), 1) == Traits::infinity());
+    failures += report("a sum with room for the weight is exact", Traits::extend(3, 4) == 7 &&
+                                                                   Traits::extend(0, INT_MAX) == INT_MAX);
+    failures += report("a sum past INT_MAX is infinity", Traits::extend(INT_MAX - 1, 2) == Traits::infinity());
+    failures += report("a sum below INT_MIN stops at INT_MIN", Traits::extend(INT_MIN, -1) == INT_MIN);
+    return failures;
+}
+// -------------------------------------------------------------------------------------------
+
+int main()
+{
+    int failures = 0;
+    failures += checkRepairSaturates();
+    failures += checkAStarSaturates();
+    failures += checkHierarchyIsKept();
+    failures += checkLandmarksMatchGraph();
+    failures += checkSnapshotByteOrder();
+    failures += checkEdgeChanges();
+    failures += checkPipelineRethrows();
+    failures += checkOutputReportsErrors();
+    failures += checkWeightTraits();
+
+    cout << (failures == 0 ? "all checks passed" : to_string(failures) + " checks failed") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+// --------------------------- searchspace.cpp -------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The searchspace.cpp file is the implementation file for the
+// SearchSpace class. It contains the methods that size and clear the
+// search space, relax the distance of a node and visit the next node.
+// ---------------------------------------------------------------------
+// Notes - The clear method takes time proportional to the number of nodes
+// the last search touched, so a search space can be reused for many
+// point-to-point searches over a large graph.
+// ---------------------------------------------------------------------
+#include "searchspace.h"
+#include <vector>
+#include <climits>
+using namespace std;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The SearchSpace constructor creates a search space for a graph with no nodes.
+// -------------------------------------------------------------------------------------------
+SearchSpace::SearchSpace()
+{
+    resize(0);
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[resize]------------------------------------------------
+// Description: The resize method sets the number of nodes in the graph being searched, every
+// node starts unreached and unvisited.
+// -------------------------------------------------------------------------------------------
+void SearchSpace::resize(int nodeCount)
+{
+    dist.assign(nodeCount + 1, INT_MAX);
+    path.assign(nodeCount + 1, 0);
+    visitedStatus.assign(nodeCount + 1, 0);
+    touched.clear();
+    heap.resize(nodeCount + 1);
+    visitedNodes = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method resets the nodes that the last search touched so that the
+// search space can be used for the next search.
+// -------------------------------------------------------------------------------------------
+void SearchSpace::clear()
+{
+    for (int node : touched)
+    {
+        dist[node] = INT_MAX;
+        path[node] = 0;
+        visitedStatus[node] = 0;
+    }
+
+    touched.clear();
+    heap.clear();
+    visitedNodes = 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[relax]------------------------------------------------
+// Description: The relax method gives the node a new distance and previous node if the new
+// distance is shorter than the node's current distance and the node has not been visited,
+// the node is then put in the heap or has its distance in the heap decreased.
+// -------------------------------------------------------------------------------------------
+bool SearchSpace::relax(int node, int newDistance, int previousNode)
+{
+    if (visitedStatus[node] != 0 || newDistance >= dist[node])
+    {
+        return false;
+    }
+
+    // The node is remembered the first time it is reached so that clear can reset it
+    if (dist[node] == INT_MAX)
+    {
+        touched.push_back(node);
+    }
+
+    dist[node] = newDistance;
+    path[node] = previousNode;
+    heap.push(node, newDistance);
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[relax]------------------------------------------------
+// Description: The A* version of the relax method gives the node a new distance and previous
+// node if the new distance is shorter than the node's current distance, and puts the node in
+// the heap by the given priority, which is the distance plus the heuristic estimate of the
+// rest of the path. With a heuristic that is admissible but not consistent a node can get a
+// shorter distance after it has been visited, so it is marked unvisited and visited again.
+// -------------------------------------------------------------------------------------------
+bool SearchSpace::relax(int node, int newDistance, int previousNode, int priority)
+{
+    if (newDistance >= dist[node])
+    {
+        return false;
+    }
+
+    // The node is remembered the first time it is reached so that clear can reset it
+    if (dist[node] == INT_MAX)
+    {
+        touched.push_back(node);
+    }
+
+    dist[node] = newDistance;
+    path[node] = previousNode;
+    visitedStatus[node] = 0;
+    heap.push(node, priority);
+    return true;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[visitNext]----------------------------------------------
+// Description: The visitNext method removes the unvisited node with the shortest distance from
+// the heap, ties are broken by the smaller node number, marks it as visited and returns it.
+// -------------------------------------------------------------------------------------------
+int SearchSpace::visitNext()
+{
+    int node = heap.popMin();
+    visitedStatus[node] = 1;
+    visitedNodes++;
+    return node;
+}
+// -------------------------------------------------------------------------------------------
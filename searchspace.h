@@ -0,0 +1,137 @@
+// ---------------------------- searchspace.h --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The searchspace.h file is the header file for the SearchSpace
+// class, which holds the state of one point-to-point search over a graph:
+// the tentative distance, the previous node and the visited status of each
+// node, together with the heap of nodes waiting to be visited. GraphM uses
+// it for the forward and backward halves of its bidirectional search.
+// ---------------------------------------------------------------------
+// Notes - A point-to-point search usually only reaches a small part of the
+// graph, so the search space remembers which nodes it has touched and the
+// clear method only resets those nodes instead of every node in the graph.
+// Unreached nodes have a distance of infinity (INT_MAX) and a previous
+// node of 0. The accessor methods are defined inline at the end of this file.
+// ---------------------------------------------------------------------
+#ifndef SEARCH_SPACE_H
+#define SEARCH_SPACE_H
+#include "indexedheap.h"
+#include <vector>
+#include <climits>
+using namespace std;
+
+class SearchSpace {
+
+    public:
+        // SearchSpace constructor creates a search space for a graph with no nodes
+        SearchSpace();
+
+        // resize sets the number of nodes, which are numbered from 1 to nodeCount, and clears the search
+        void resize(int nodeCount);
+
+        // clear resets every node that the last search touched
+        void clear();
+
+        // Methods for getting the distance, previous node and visited status of a node
+        int distance(int node) const;
+        int previous(int node) const;
+        bool visited(int node) const;
+
+        // relax gives the node a new distance and previous node if the distance is shorter than its
+        // current distance and puts it in the heap, it returns true if the distance was changed
+        bool relax(int node, int newDistance, int previousNode);
+
+        // Version of relax for A* search, the node is put in the heap by its priority instead of its
+        // distance, and a visited node that gets a shorter distance is put back in the heap
+        bool relax(int node, int newDistance, int previousNode, int priority);
+
+        // Methods for the heap of reached nodes that have not been visited yet, minDistance
+        // returns the smallest priority when the A* version of relax is used
+        bool empty() const;
+        int minDistance() const;
+
+        // visitNext removes the unvisited node with the shortest distance from the heap,
+        // marks it as visited and returns it
+        int visitNext();
+
+        // visitedCount returns the number of nodes visited since the last clear
+        int visitedCount() const;
+
+    private:
+        // Tentative distance, previous node and visited status of each node
+        vector<int> dist;
+        vector<int> path;
+        vector<char> visitedStatus;
+
+        // Nodes whose distance has been changed since the last clear
+        vector<int> touched;
+
+        // Heap of the reached nodes that have not been visited yet
+        IndexedHeap<4> heap;
+
+        // Number of nodes visited since the last clear
+        int visitedNodes;
+};
+
+// -----------------------------------[distance]----------------------------------------------
+// Description: The distance method returns the tentative distance of the node, or infinity
+// if the node has not been reached.
+// -------------------------------------------------------------------------------------------
+inline int SearchSpace::distance(int node) const
+{
+    return dist[node];
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[previous]----------------------------------------------
+// Description: The previous method returns the node before this node on its path, or 0 if
+// the node has not been reached or is where the search started.
+// -------------------------------------------------------------------------------------------
+inline int SearchSpace::previous(int node) const
+{
+    return path[node];
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[visited]-----------------------------------------------
+// Description: The visited method returns true if the node has been visited, which means its
+// distance is final.
+// -------------------------------------------------------------------------------------------
+inline bool SearchSpace::visited(int node) const
+{
+    return visitedStatus[node] != 0;
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[empty]------------------------------------------------
+// Description: The empty method returns true if there are no reached nodes left to visit.
+// -------------------------------------------------------------------------------------------
+inline bool SearchSpace::empty() const
+{
+    return heap.empty();
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[minDistance]---------------------------------------------
+// Description: The minDistance method returns the shortest distance of the nodes waiting to be
+// visited, or infinity if there are none.
+// -------------------------------------------------------------------------------------------
+inline int SearchSpace::minDistance() const
+{
+    return heap.empty() ? INT_MAX : heap.minDistance();
+}
+// -------------------------------------------------------------------------------------------
+
+// --------------------------------[visitedCount]---------------------------------------------
+// Description: The visitedCount method returns the number of nodes visited since the last clear.
+// -------------------------------------------------------------------------------------------
+inline int SearchSpace::visitedCount() const
+{
+    return visitedNodes;
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
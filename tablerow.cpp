@@ -0,0 +1,69 @@
+// ---------------------------- tablerow.cpp ---------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The tablerow.cpp file is the implementation file for the
+// TableRow class. It contains the methods that size, fill in and clear
+// the arrays of a row.
+// ---------------------------------------------------------------------
+// Notes - The vectors keep their capacity when a row is reset, so running
+// Dijkstra's algorithm from the same source node again does not allocate.
+// ---------------------------------------------------------------------
+#include "tablerow.h"
+#include <vector>
+#include <climits>
+#include <cstdint>
+using namespace std;
+
+// ---------------------------------[Constructor]---------------------------------------------
+// Description: The TableRow constructor creates an empty row.
+// -------------------------------------------------------------------------------------------
+TableRow::TableRow()
+{
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[reset]------------------------------------------------
+// Description: The reset method sizes the arrays for nodes 0 to nodeCount, every node is
+// unvisited, at a distance of infinity and has a path entry of 0.
+// -------------------------------------------------------------------------------------------
+void TableRow::reset(int nodeCount)
+{
+    distances.assign(nodeCount + 1, INT_MAX);
+    paths.assign(nodeCount + 1, 0);
+    visitedBits.assign(nodeCount / 64 + 1, 0);
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[load]------------------------------------------------
+// Description: The load method copies the distances and path entries of nodes 0 to nodeCount
+// into the row, the nodes that have a distance are marked as visited.
+// -------------------------------------------------------------------------------------------
+void TableRow::load(int nodeCount, const int* distanceArray, const int* pathArray)
+{
+    distances.assign(distanceArray, distanceArray + nodeCount + 1);
+    paths.assign(pathArray, pathArray + nodeCount + 1);
+    visitedBits.assign(nodeCount / 64 + 1, 0);
+
+    for (int node = 0; node <= nodeCount; node++)
+    {
+        if (distances[node] != INT_MAX)
+        {
+            setVisited(node, true);
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+// ------------------------------------[clear]------------------------------------------------
+// Description: The clear method throws the arrays of the row away and releases their memory.
+// -------------------------------------------------------------------------------------------
+void TableRow::clear()
+{
+    vector<int>().swap(distances);
+    vector<int>().swap(paths);
+    vector<uint64_t>().swap(visitedBits);
+}
+// -------------------------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+// ----------------------------- tablerow.h ----------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The tablerow.h file is the header file for the TableRow
+// class, which stores one row of the table T of GraphM: the shortest
+// distance from the row's source node to each node, the node before each
+// node on its shortest path and whether each node has been visited.
+// ---------------------------------------------------------------------
+// Notes - The row is stored as a structure of arrays instead of an array
+// of structs, the distances and the path entries are two dense int arrays
+// and the visited status is a bitset with one bit for each node. A cell
+// of the row takes a little over 8 bytes, and the loops of Dijkstra's
+// algorithm only read the arrays they need. Nodes are numbered from 1 to
+// nodeCount and entry 0 is unused. An empty row has no arrays at all,
+// which is how GraphM marks a row that has not been computed. The
+// accessor methods are defined inline at the end of this file.
+// ---------------------------------------------------------------------
+#ifndef TABLE_ROW_H
+#define TABLE_ROW_H
+#include <vector>
+#include <cstdint>
+using namespace std;
+
+class TableRow {
+
+    public:
+        // TableRow constructor creates an empty row
+        TableRow();
+
+        // reset sizes the row for nodes 1 to nodeCount, every node starts unvisited, at a
+        // distance of infinity (INT_MAX) and with a path entry of 0
+        void reset(int nodeCount);
+
+        // load sets the row from arrays of distances and path entries for nodes 0 to nodeCount,
+        // a node is visited if its distance is not infinity
+        void load(int nodeCount, const int* distanceArray, const int* pathArray);
+
+        // clear throws the arrays away, and empty returns true if the row has no arrays
+        void clear();
+        bool empty() const;
+
+        // Methods for getting the shortest distance, the path entry and the visited status of a node
+        int distance(int node) const;
+        int path(int node) const;
+        bool visited(int node) const;
+
+        // Methods for setting the shortest distance, the path entry and the visited status of a node
+        void setDistance(int node, int distance);
+        void setPath(int node, int previousNode);
+        void setVisited(int node, bool status);
+
+    private:
+        // Shortest distance and path entry of each node
+        vector<int> distances;
+        vector<int> paths;
+
+        // Visited status of each node, node n is bit n % 64 of word n / 64
+        vector<uint64_t> visitedBits;
+};
+
+// ------------------------------------[empty]------------------------------------------------
+// Description: The empty method returns true if the row has not been sized for any nodes.
+// -------------------------------------------------------------------------------------------
+inline bool TableRow::empty() const
+{
+    return distances.empty();
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[distance]----------------------------------------------
+// Description: The distance method returns the shortest distance of the node found so far,
+// or infinity if the node has not been reached.
+// -------------------------------------------------------------------------------------------
+inline int TableRow::distance(int node) const
+{
+    return distances[node];
+}
+// -------------------------------------------------------------------------------------------
+
+// -------------------------------------[path]------------------------------------------------
+// Description: The path method returns the node before this node on its shortest path, or 0
+// if the node has not been reached or is the source node.
+// -------------------------------------------------------------------------------------------
+inline int TableRow::path(int node) const
+{
+    return paths[node];
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[visited]-----------------------------------------------
+// Description: The visited method returns true if the node has been visited.
+// -------------------------------------------------------------------------------------------
+inline bool TableRow::visited(int node) const
+{
+    return (visitedBits[node >> 6] >> (node & 63)) & 1;
+}
+// -------------------------------------------------------------------------------------------
+
+// ---------------------------------[setDistance]---------------------------------------------
+// Description: The setDistance method sets the shortest distance of the node.
+// -------------------------------------------------------------------------------------------
+inline void TableRow::setDistance(int node, int distance)
+{
+    distances[node] = distance;
+}
+// -------------------------------------------------------------------------------------------
+
+// -----------------------------------[setPath]-----------------------------------------------
+// Description: The setPath method sets the node before this node on its shortest path.
+// -------------------------------------------------------------------------------------------
+inline void TableRow::setPath(int node, int previousNode)
+{
+    paths[node] = previousNode;
+}
+// -------------------------------------------------------------------------------------------
+
+// ----------------------------------[setVisited]---------------------------------------------
+// Description: The setVisited method sets or clears the visited bit of the node.
+// -------------------------------------------------------------------------------------------
+inline void TableRow::setVisited(int node, bool status)
+{
+    uint64_t bit = uint64_t(1) << (node & 63);
+
+    if (status)
+    {
+        visitedBits[node >> 6] |= bit;
+    }
+    else
+    {
+        visitedBits[node >> 6] &= ~bit;
+    }
+}
+// -------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,62 @@
+// --------------------------- weighttraits.h --------------------------
+// David Schurer
+// CSS 343
+// Creation Date: 10/17/2026
+// Date of Last Modification: 10/17/2026
+// ---------------------------------------------------------------------
+// Purpose - The weighttraits.h file is the header file for the
+// WeightTraits class template, which gives the shortest path searches
+// the value used for infinity and the addition of an edge weight to a
+// distance. GraphM and the contraction hierarchy use it for their int
+// weights.
+// ---------------------------------------------------------------------
+// Notes - A distance plus a weight saturates instead of overflowing: a
+// sum past INT_MAX is infinity, which is never shorter than a distance a
+// node already has, so the node is left unreached the same way as a node
+// with no path. Infinity plus a weight stays infinity, and a negative
+// weight that would take a sum below INT_MIN gives INT_MIN. Only int
+// weights are defined, since T, the snapshot file and the dense and
+// Floyd-Warshall kernels all store int distances, so using WeightTraits
+// with any other weight type does not compile.
+// ---------------------------------------------------------------------
+#ifndef WEIGHT_TRAITS_H
+#define WEIGHT_TRAITS_H
+#include <limits>
+using namespace std;
+
+// The general template is only declared, WeightTraits<int> below is the one weight type
+template <typename Weight>
+struct WeightTraits;
+
+// WeightTraits for int weights, the sum saturates at the largest and smallest distances
+template <>
+struct WeightTraits<int>
+{
+    // Type of a distance, the sum of the weights along a path
+    typedef int Distance;
+
+    // infinity returns the distance of a node that has not been reached, the largest distance
+    static constexpr Distance infinity()
+    {
+        return numeric_limits<Distance>::max();
+    }
+
+    // extend returns the distance plus the weight of an edge, infinity if the sum is past the
+    // largest distance and the smallest distance if a negative weight takes it below that
+    static Distance extend(Distance distance, int weight)
+    {
+        if (distance == infinity() || (weight > 0 && distance > infinity() - weight))
+        {
+            return infinity();
+        }
+
+        if (weight < 0 && distance < numeric_limits<Distance>::min() - weight)
+        {
+            return numeric_limits<Distance>::min();
+        }
+
+        return distance + weight;
+    }
+};
+
+#endif